@@ -4,9 +4,22 @@
 /// Updated 26-nov-2010
 /// Updated 24-apr-2022
 /// Updated 25-sep-2023
+/// Updated 15-oct-2026
 #pragma once
 #ifndef PCH
+    #include <algorithm>
+    #include <chrono>
+    #include <concepts>
+    #include <cstddef>
+    #include <limits>
+    #include <memory>
+    #include <memory_resource>
+    #include <span>
+    #include <stop_token>
+    #include <type_traits>
+    #include <unordered_map>
     #include <utility>
+    #include <vector>
 #endif
 
 namespace stdext::astar
@@ -16,7 +29,8 @@ namespace stdext::astar
     /// heuristic score (h). For more details see
     /// http://en.wikipedia.org/wiki/A*_search_algorithm#Algorithm_description. The
     /// descendant of this class has to provide two methods: the distance/cost to
-    /// another node (signature Value distance_to( const node_type& node) const) and
+    /// another node (signature Value distance_to( const node_type& node) const), unless
+    /// the enumerator provides the edge costs (see weighted_enumerator), and
     /// the estimated (heuristic) distance/cost to target node (signature void
     /// set_heuristic_score( const node_type& target_node)).
     template <typename _Score>
@@ -57,6 +71,294 @@ namespace stdext::astar
         score_type heuristic_score_ {};
     };
 
+    /// Default node index functor - maps a node to its dense index using the id() method of the node.
+    struct node_index
+    {
+        std::size_t operator()(const auto& node) const noexcept { return static_cast<std::size_t>(node.id()); }
+    };
+
+    /// Solution verifier comparing the id() of the node with the id of the target node.
+    struct target_id_verifier
+    {
+        std::size_t id {};
+
+        target_id_verifier() = default;
+        target_id_verifier(const auto& target_node) noexcept requires requires { target_node.id(); }: id(static_cast<std::size_t>(target_node.id())) {}
+
+        bool operator()(const auto& node) const noexcept { return static_cast<std::size_t>(node.id()) == id; }
+        void set_target(const auto& target_node) noexcept { id = static_cast<std::size_t>(target_node.id()); }
+    };
+
+    /// Solution verifier recognizing any node whose id() is the id of one of the target nodes, e.g. the nearest of
+    /// several facilities (see the multi-target constructor of @ref algo).
+    struct target_ids_verifier
+    {
+        std::vector<std::size_t> ids;
+
+        target_ids_verifier() = default;
+
+        /// @param[in] target_nodes Range of target nodes
+        template <typename _Nodes>
+        explicit target_ids_verifier(const _Nodes& target_nodes) { set_targets(target_nodes); }
+
+        bool operator()(const auto& node) const noexcept { return std::binary_search(ids.begin(), ids.end(), static_cast<std::size_t>(node.id())); }
+
+        void set_target(const auto& target_node) { ids.assign(1, static_cast<std::size_t>(target_node.id())); }
+
+        template <typename _Nodes>
+        void set_targets(const _Nodes& target_nodes)
+        {
+            ids.clear();
+            for (const auto& node: target_nodes)
+                ids.push_back(static_cast<std::size_t>(node.id()));
+
+            std::sort(ids.begin(), ids.end());
+        }
+    };
+
+    /// Aggregate of the heuristic scores towards several target nodes (see @ref algo): the minimum, which is
+    /// admissible and consistent when the heuristic towards each target is.
+    struct min_heuristic
+    {
+        template <typename _Score>
+        _Score operator()(const _Score aggregate, const _Score score) const noexcept
+        {
+            return std::min(aggregate, score);
+        }
+    };
+
+    /// Priority queue able to update the score of a node which is already queued (see @ref indexed_dary_heap).
+    template <typename _Queue, typename _Node>
+    concept decrease_key_queue = requires(_Queue& queue, const _Node& node) {
+        static_cast<bool>(queue.contains(node));
+        queue.decrease_key(node);
+    };
+
+    /// Node table able to cache the heuristic scores per target node (see dense_node_table::set_heuristic_cache).
+    template <typename _Table, typename _Node>
+    concept heuristic_cache_table = requires(_Table& table, const _Node& node) {
+        table.set_heuristic_target(table.index(node));
+        table.heuristic_score(table.index(node), [] { return typename _Node::score_type {}; });
+    };
+
+    /// Neighbor enumerator protocol: enumerator(node) starts the enumeration of the nodes adjacent to the node,
+    /// the enumerator converts to false when there are no more nodes, ++enumerator advances and *enumerator gets the
+    /// current adjacent node.
+    template <typename _Enumerator, typename _Node>
+    concept neighbor_enumerator = requires(_Enumerator& enumerator, const _Node& node) {
+        enumerator(node);
+        static_cast<bool>(enumerator);
+        ++enumerator;
+        *enumerator;
+    };
+
+    /// Neighbor enumerator yielding also the cost of the edge to the current node (enumerator.cost()), e.g. a weight
+    /// stored with the adjacency. The algorithms use it instead of calling distance_to of the nodes.
+    template <typename _Enumerator, typename _Score>
+    concept weighted_enumerator = requires(const _Enumerator& enumerator) {
+        { enumerator.cost() } -> std::convertible_to<_Score>;
+    };
+
+    namespace detail
+    {
+        /// Gets the cost of the edge from node to the current neighbor of the enumerator: the stored weight of a
+        /// @ref weighted_enumerator, otherwise node.distance_to(neighbor).
+        template <typename _Enumerator, typename _Node>
+        auto edge_cost(const _Enumerator& enumerator, const _Node& node, const _Node& neighbor)
+        {
+            if constexpr (weighted_enumerator<_Enumerator, typename _Node::score_type>)
+                return static_cast<typename _Node::score_type>(enumerator.cost());
+            else
+                return node.distance_to(neighbor);
+        }
+    } // namespace detail
+
+    /// Neighbors of a node handed over at once: the dense indexes of the neighbors and the costs of the edges.
+    template <typename _Index, typename _Score>
+    struct neighbor_batch
+    {
+        std::span<const _Index> ids;
+        std::span<const _Score> costs;
+    };
+
+    /// Neighbor enumerator able to hand over all the neighbors of a node as a @ref neighbor_batch
+    /// (enumerator.batch(node)) and to materialize a neighbor node from its id (enumerator.node(id)). In dense mode
+    /// @ref algo tests the batch against the node table by id and materializes only the neighbors it relaxes.
+    template <typename _Enumerator, typename _Node>
+    concept batch_enumerator = requires(_Enumerator& enumerator, const _Node& node) {
+        enumerator.batch(node).ids.size();
+        enumerator.batch(node).costs.size();
+        { enumerator.node(enumerator.batch(node).ids[0]) } -> std::same_as<_Node&>;
+    };
+
+    /// Neighbor enumerator able to generate the candidate neighbors of a node independently of each other, so they
+    /// can be generated concurrently: enumerator.candidate_count(node) gets the number of candidates and
+    /// enumerator.generate(node, index, neighbor) builds the candidate into neighbor and gets the cost of the edge,
+    /// or an empty optional if the candidate is not a neighbor (e.g. it fails a collision check). generate has to be
+    /// thread safe. @ref algo generates the candidates on its @ref executor and merges them in index order.
+    template <typename _Enumerator, typename _Node>
+    concept parallel_enumerator = requires(const _Enumerator& enumerator, const _Node& node, _Node& neighbor, std::size_t index) {
+        { enumerator.candidate_count(node) } -> std::convertible_to<std::size_t>;
+        { *enumerator.generate(node, index, neighbor) } -> std::convertible_to<typename _Node::score_type>;
+    };
+
+    /// Executor of parallel loops, e.g. a thread pool adapter (see pool_executor).
+    class executor
+    {
+    public:
+        virtual ~executor() = default;
+
+        /// Calls function(context, index) for all indexes in [0, count), possibly concurrently, and returns when
+        /// all the calls returned.
+        virtual void parallel_for(std::size_t count, void (*function)(void* context, std::size_t index), void* context) = 0;
+    };
+
+    namespace detail
+    {
+        /// Overrides the heuristic score of the node with an already evaluated one. A node exposing
+        /// set_heuristic_score(score) (e.g. a @ref node_handle, which mirrors it into the referred node) handles it
+        /// itself; otherwise it is stored by @ref base_node.
+        template <typename _Node>
+        void assign_heuristic_score(_Node& node, const typename _Node::score_type score) noexcept
+        {
+            if constexpr (requires { node.set_heuristic_score(score); })
+                node.set_heuristic_score(score);
+            else
+                static_cast<base_node<typename _Node::score_type>&>(node).set_heuristic_score(score);
+        }
+
+        /// Sets the heuristic score of the node, evaluating it only if the table has no cached score for it.
+        template <typename _Table, typename _Node>
+        void set_heuristic_score(_Table& table, _Node& node, const typename _Node::score_type general_score, const _Node& target_node)
+        {
+            if constexpr (heuristic_cache_table<_Table, _Node>)
+            {
+                const auto score = table.heuristic_score(table.index(node), [&] {
+                    node.set_heuristic_score(general_score, target_node);
+                    return node.heuristic_score();
+                });
+                assign_heuristic_score(node, score);
+            }
+            else
+                node.set_heuristic_score(general_score, target_node);
+        }
+
+        /// Multiplies the heuristic score of the node by the inflation factor epsilon (see algo::set_epsilon).
+        template <typename _Node>
+        void inflate_heuristic_score(_Node& node, const double epsilon) noexcept
+        {
+            using score_type = typename _Node::score_type;
+            assign_heuristic_score(node, static_cast<score_type>(node.heuristic_score() * epsilon));
+        }
+    } // namespace detail
+
+    /// Reverse neighbor enumerator - same protocol as @ref neighbor_enumerator, but enumerating the predecessors of
+    /// the node (the nodes having an edge towards it). On undirected graphs the forward enumerator fits both.
+    /// The cost() of a weighted reverse enumerator is the cost of the edge from the predecessor to the node.
+    template <typename _Enumerator, typename _Node>
+    concept reverse_neighbor_enumerator = neighbor_enumerator<_Enumerator, _Node>;
+
+    /// Set able to report the best known general score of a node.
+    template <typename _Set, typename _Node>
+    concept scored_set = requires(const _Set& set, const _Node& node) { set.general_score(node) < node.general_score(); };
+
+    /// Node table keeping the whole per node state (open/closed state, best general score and parent) of the
+    /// algorithm, like @ref dense_node_table. When used as _Set, it replaces the open set, the closed set and the
+    /// solution map of @ref algo.
+    template <typename _Table, typename _Node>
+    concept node_table = requires(_Table& table, const _Node& node, typename _Node::score_type score) {
+        static_cast<bool>(table.is_open(node));
+        static_cast<bool>(table.is_closed(node));
+        table.open(node, score);
+        table.close(node);
+        table.set_parent(node, node);
+        table.general_score(node);
+    };
+
+    namespace detail
+    {
+        /// Placeholder of the members not used by the current configuration.
+        struct unused_member
+        {
+        };
+
+        /// Candidate neighbor generated by a @ref parallel_enumerator.
+        template <typename _Node>
+        struct neighbor_candidate
+        {
+            _Node node;
+            typename _Node::score_type cost {};
+            bool valid {};
+        };
+
+        /// Creates a container using the allocator if the container supports it (uses-allocator construction),
+        /// otherwise default constructs it.
+        template <typename _Type>
+        _Type make_with_allocator(const std::pmr::polymorphic_allocator<std::byte>& allocator)
+        {
+            if constexpr (std::uses_allocator_v<_Type, std::pmr::polymorphic_allocator<std::byte>>)
+                return std::make_obj_using_allocator<_Type>(allocator);
+            else
+                return _Type {};
+        }
+    }
+
+    /// Counters collected by the algorithm.
+    struct search_statistics
+    {
+        /// Number of expanded nodes.
+        std::size_t expanded_nodes {};
+
+        /// Number of dropped queue entries belonging to already closed nodes.
+        std::size_t dropped_closed_entries {};
+
+        /// Number of dropped queue entries superseded by a better entry of the same node.
+        std::size_t dropped_superseded_entries {};
+
+        /// Gets the total number of dropped (stale) queue entries.
+        std::size_t dropped_entries() const noexcept { return dropped_closed_entries + dropped_superseded_entries; }
+    };
+
+    namespace detail
+    {
+        /// Calls step() until it returns false or count steps were done.
+        /// @return Returns the result of the last step, or true if no step was done.
+        template <typename _Step>
+        bool run_steps(_Step& step, std::size_t count)
+        {
+            for (; count != 0; --count)
+                if (!step())
+                    return false;
+
+            return true;
+        }
+
+        /// Calls step() until it returns false or the time budget is spent, checking the clock once per
+        /// check_interval steps.
+        template <typename _Step>
+        bool run_for(_Step& step, const std::chrono::nanoseconds budget, const std::size_t check_interval)
+        {
+            const auto deadline = std::chrono::steady_clock::now() + budget;
+            while (std::chrono::steady_clock::now() < deadline)
+                if (!run_steps(step, std::max<std::size_t>(check_interval, 1)))
+                    return false;
+
+            return true;
+        }
+
+        /// Calls step() until it returns false or a stop is requested, checking the token once per check_interval
+        /// steps.
+        template <typename _Step>
+        bool run_until(_Step& step, const std::stop_token& token, const std::size_t check_interval)
+        {
+            while (!token.stop_requested())
+                if (!run_steps(step, std::max<std::size_t>(check_interval, 1)))
+                    return false;
+
+            return true;
+        }
+    } // namespace detail
+
     /// Dummy beam search functor.
     struct no_beam_search
     {
@@ -67,8 +369,13 @@ namespace stdext::astar
     /// (http://en.wikipedia.org/wiki/A*_search_algorithm). Features: Fully
     /// customizable internal data structures, step-by-step execution and beam
     /// search support.
+    /// @note Dense node table mode: if _Set is a @ref node_table (e.g. @ref dense_node_table), it holds the whole
+    /// per node state and _SolutionMap has to be the same type - the table is also the solution.
+    /// @note Multi-source, multi-target mode: the search may start from several nodes, each one with its own initial
+    /// general score, and end at any of several target nodes. The heuristic score is then folded over the targets by
+    /// _HeuristicAggregate (aggregate(aggregate score, score towards the next target)), by default the minimum.
     template <typename _Node, typename _PriorityQueue, typename _NeighborEnumerator, typename _Set, typename _SolutionVerifier,
-              typename _SolutionMap, typename _BeamSearch = no_beam_search>
+              typename _SolutionMap, typename _BeamSearch = no_beam_search, typename _HeuristicAggregate = min_heuristic>
     class algo
     {
     public:
@@ -79,6 +386,26 @@ namespace stdext::astar
         using solution_verifier_type = _SolutionVerifier;
         using solution_map_type = _SolutionMap;
         using beam_search_type = _BeamSearch;
+        using heuristic_aggregate_type = _HeuristicAggregate;
+
+        /// Checks if the algorithm runs in dense node table mode.
+        static constexpr bool dense_mode = node_table<set_type, node_type>;
+
+        static_assert(!dense_mode || std::is_same_v<set_type, solution_map_type>, "the node table has to be also the solution map");
+
+        /// Checks if the algorithm relaxes the neighbors in batches (see @ref batch_enumerator).
+        static constexpr bool batch_mode = dense_mode && batch_enumerator<neighbor_enumerator_type, node_type> &&
+                                           requires(const set_type& table) { table.relax_limit(0); };
+
+        /// Checks if the algorithm generates the neighbors on an executor (see @ref parallel_enumerator). It needs the
+        /// dense node table mode: the candidates are copies, so only the table knows their best general scores.
+        static constexpr bool parallel_mode = dense_mode && !batch_mode && parallel_enumerator<neighbor_enumerator_type, node_type>;
+
+        static_assert(dense_mode || !parallel_enumerator<neighbor_enumerator_type, node_type> || neighbor_enumerator<neighbor_enumerator_type, node_type>,
+                      "a parallel enumerator needs the dense node table mode, unless it is also a neighbor enumerator");
+
+        /// Default number of expansions between two checks of the clock or of the stop token (see @ref run_for).
+        static constexpr std::size_t default_check_interval = 64;
 
         /// @param[in] start_node Start node
         /// @param[in] target_node Target node
@@ -96,9 +423,112 @@ namespace stdext::astar
             neighbor_enumerator_(std::move(neighbor_enumerator)),
             target_node_(std::move(target_node))
         {
-            start_node.set_heuristic_score(0, target_node_);
-            open_set_.insert(start_node);
-            priority_open_set_.push(std::move(start_node));
+            open_start(std::move(start_node));
+        }
+
+        /// Creates the algorithm having all owned containers (priority queue, sets and solution map) allocating from
+        /// the given memory resource, e.g. a @ref search_arena. The containers which are not allocator-aware with
+        /// std::pmr::polymorphic_allocator (e.g. std::set with std::allocator) use their own allocator.
+        /// @param[in] resource Memory resource of the containers. It has to outlive the algorithm.
+        /// @see The other parameters are described by the constructor above.
+        algo(node_type start_node, node_type target_node, solution_verifier_type solution_verifier,
+             neighbor_enumerator_type neighbor_enumerator, beam_search_type beam_search, std::pmr::memory_resource* const resource):
+            solution_verifier_(std::move(solution_verifier)),
+            beam_search_(std::move(beam_search)),
+            neighbor_enumerator_(std::move(neighbor_enumerator)),
+            priority_open_set_(detail::make_with_allocator<priority_queue_type>(resource)),
+            open_set_(detail::make_with_allocator<set_type>(resource)),
+            closed_set_(detail::make_with_allocator<decltype(closed_set_)>(resource)),
+            solution_(detail::make_with_allocator<decltype(solution_)>(resource)),
+            candidates_(detail::make_with_allocator<decltype(candidates_)>(resource)),
+            target_node_(std::move(target_node)),
+            target_nodes_(resource),
+            start_scores_(detail::make_with_allocator<decltype(start_scores_)>(resource))
+        {
+            open_start(std::move(start_node));
+        }
+
+        /// @brief Creates a multi-source, multi-target search: all the start nodes are opened at once with their own
+        /// general scores as initial costs (like the edges of a super source) and the heuristic score of a node is the
+        /// aggregate of its heuristic scores towards the target nodes. E.g. the nearest of K facilities takes a single
+        /// search either from the facilities to a node or from a node to the facilities.
+        /// @param[in] start_nodes Start nodes; their general scores are the initial costs
+        /// @param[in] target_nodes Target nodes; there has to be at least one
+        /// @param[in] solution_verifier Verifier recognizing any of the target nodes (e.g. @ref target_ids_verifier)
+        /// @param[in] resource Memory resource of the containers (see the constructor above)
+        /// @see The other parameters are described by the first constructor.
+        algo(const std::span<const node_type> start_nodes, const std::span<const node_type> target_nodes, solution_verifier_type solution_verifier,
+             neighbor_enumerator_type neighbor_enumerator, beam_search_type beam_search,
+             std::pmr::memory_resource* const resource = std::pmr::get_default_resource()):
+            solution_verifier_(std::move(solution_verifier)),
+            beam_search_(std::move(beam_search)),
+            neighbor_enumerator_(std::move(neighbor_enumerator)),
+            priority_open_set_(detail::make_with_allocator<priority_queue_type>(resource)),
+            open_set_(detail::make_with_allocator<set_type>(resource)),
+            closed_set_(detail::make_with_allocator<decltype(closed_set_)>(resource)),
+            solution_(detail::make_with_allocator<decltype(solution_)>(resource)),
+            candidates_(detail::make_with_allocator<decltype(candidates_)>(resource)),
+            target_node_(target_nodes.front()),
+            target_nodes_(target_nodes.begin(), target_nodes.end(), resource),
+            start_scores_(detail::make_with_allocator<decltype(start_scores_)>(resource))
+        {
+            open_starts(start_nodes);
+        }
+
+        /// Prepares a new search keeping the allocated memory of the containers: a dense node table starts a new
+        /// generation (see @ref dense_node_table) and the priority queue is cleared in place. The solution verifier
+        /// and the neighbor enumerator are retargeted if they provide set_target(target_node).
+        /// @param[in] start_node Start node
+        /// @param[in] target_node Target node
+        void reset(node_type start_node, node_type target_node)
+        {
+            clear();
+            target_nodes_.clear();
+            target_node_ = std::move(target_node);
+            if constexpr (requires { solution_verifier_.set_target(target_node_); })
+                solution_verifier_.set_target(target_node_);
+
+            if constexpr (requires { neighbor_enumerator_.set_target(target_node_); })
+                neighbor_enumerator_.set_target(target_node_);
+
+            open_start(std::move(start_node));
+        }
+
+        /// Prepares a new search replacing also the solution verifier (see @ref reset).
+        void reset(node_type start_node, node_type target_node, solution_verifier_type solution_verifier)
+        {
+            solution_verifier_ = std::move(solution_verifier);
+            reset(std::move(start_node), std::move(target_node));
+        }
+
+        /// Prepares a new multi-source, multi-target search (see the multi-target constructor and @ref reset). The
+        /// solution verifier and the neighbor enumerator are retargeted if they provide set_targets(target nodes);
+        /// otherwise, if they provide set_target(target_node), they get the first target node.
+        /// @param[in] start_nodes Start nodes; their general scores are the initial costs
+        /// @param[in] target_nodes Target nodes; there has to be at least one
+        void reset(const std::span<const node_type> start_nodes, const std::span<const node_type> target_nodes)
+        {
+            clear();
+            target_nodes_.assign(target_nodes.begin(), target_nodes.end());
+            target_node_ = target_nodes.front();
+            if constexpr (requires { solution_verifier_.set_targets(target_nodes); })
+                solution_verifier_.set_targets(target_nodes);
+            else if constexpr (requires { solution_verifier_.set_target(target_node_); })
+                solution_verifier_.set_target(target_node_);
+
+            if constexpr (requires { neighbor_enumerator_.set_targets(target_nodes); })
+                neighbor_enumerator_.set_targets(target_nodes);
+            else if constexpr (requires { neighbor_enumerator_.set_target(target_node_); })
+                neighbor_enumerator_.set_target(target_node_);
+
+            open_starts(start_nodes);
+        }
+
+        /// Prepares a new multi-source, multi-target search replacing also the solution verifier.
+        void reset(const std::span<const node_type> start_nodes, const std::span<const node_type> target_nodes, solution_verifier_type solution_verifier)
+        {
+            solution_verifier_ = std::move(solution_verifier);
+            reset(start_nodes, target_nodes);
         }
 
         /// Checks if the solution was found. If the return is true, the solution can
@@ -106,10 +536,22 @@ namespace stdext::astar
         bool has_solution() const noexcept { return has_solution_; }
 
         /// Gets the solution instance.
-        const solution_map_type& solution() const noexcept { return solution_; }
+        const solution_map_type& solution() const noexcept
+        {
+            if constexpr (dense_mode)
+                return open_set_;
+            else
+                return solution_;
+        }
 
         /// Gets the solution instance.
-        solution_map_type& solution() noexcept { return solution_; }
+        solution_map_type& solution() noexcept
+        {
+            if constexpr (dense_mode)
+                return open_set_;
+            else
+                return solution_;
+        }
 
         /// Gets the solution verifier.
         const solution_verifier_type& solution_verifier() const noexcept { return solution_verifier_; }
@@ -120,6 +562,22 @@ namespace stdext::astar
         /// Gets the beam search object.
         const beam_search_type& beam_search() const noexcept { return beam_search_; }
 
+        /// Gets the search counters.
+        const search_statistics& statistics() const noexcept { return statistics_; }
+
+        /// Sets the executor generating the neighbors in @ref parallel_mode; without one they are generated by the
+        /// calling thread. The executor has to outlive the algorithm.
+        void set_executor(executor* const value) noexcept { executor_ = value; }
+
+        /// Gets the inflation factor of the heuristic scores.
+        double epsilon() const noexcept { return epsilon_; }
+
+        /// Sets the inflation factor epsilon >= 1 of the heuristic scores, turning the search into weighted A*: the
+        /// nodes closer to the target are preferred, so a path is found after fewer expansions, and its cost is at
+        /// most epsilon times the optimal cost for a consistent heuristic. It applies to the nodes evaluated after
+        /// the call, so it is usually set before the search or after @ref reset.
+        void set_epsilon(const double epsilon) noexcept { epsilon_ = epsilon; }
+
         /// @brief algo progress method - useful for fined grained execution, early
         /// exit (see
         /// http://theory.stanford.edu/~amitp/GameProgramming/ImplementationNotes.html#S16)
@@ -132,10 +590,49 @@ namespace stdext::astar
         /// false then no solution was found.
         /// @note The implementation is based on pseudo code from
         /// http://en.wikipedia.org/wiki/A*_search_algorithm#Pseudo_code.
+        /// @note A priority queue without decrease-key keeps stale duplicates of the re-pushed nodes. These are
+        /// silently dropped (lazy deletion) before the expansion and counted in @ref statistics.
         bool operator()()
+        {
+            attach_queue();
+            return step();
+        }
+
+        /// Runs at most count steps of the algorithm (see @ref operator()()) in a tight loop.
+        /// @return Returns true if the algorithm should continue, false if it ended (see @ref has_solution).
+        bool run_steps(const std::size_t count)
+        {
+            attach_queue();
+            const auto step = [this] { return this->step(); };
+            return detail::run_steps(step, count);
+        }
+
+        /// Runs the algorithm until it ends or the time budget is spent. The steady clock is read only once per
+        /// check_interval expansions, so the budget may be exceeded by the duration of that many expansions.
+        /// @return Returns true if the algorithm should continue, false if it ended (see @ref has_solution).
+        bool run_for(const std::chrono::nanoseconds budget, const std::size_t check_interval = default_check_interval)
+        {
+            attach_queue();
+            const auto step = [this] { return this->step(); };
+            return detail::run_for(step, budget, check_interval);
+        }
+
+        /// Runs the algorithm until it ends or a stop is requested on the token, which is checked once per
+        /// check_interval expansions.
+        /// @return Returns true if the algorithm should continue, false if it ended (see @ref has_solution).
+        bool run_until(const std::stop_token token, const std::size_t check_interval = default_check_interval)
+        {
+            attach_queue();
+            const auto step = [this] { return this->step(); };
+            return detail::run_until(step, token, check_interval);
+        }
+
+    protected:
+        /// Progress step of @ref operator()() with the queue already attached to the node table.
+        bool step()
         {
             bool can_continue = false;
-            if (!open_set_.empty())
+            if (!open_set_.empty() && drop_stale_entries())
             {
                 node_ = priority_open_set_.top();
                 has_solution_ = solution_verifier_(node_);
@@ -149,30 +646,285 @@ namespace stdext::astar
             return can_continue;
         }
 
-    protected:
+        /// Checks if the queue entry belongs to a closed node or was superseded by a better entry of the same node.
+        bool is_stale(const node_type& node)
+        {
+            if (is_closed(node))
+            {
+                ++statistics_.dropped_closed_entries;
+                return true;
+            }
+
+            if constexpr (scored_set<set_type, node_type>)
+                if (open_set_.general_score(node) < node.general_score())
+                {
+                    ++statistics_.dropped_superseded_entries;
+                    return true;
+                }
+
+            return false;
+        }
+
+        /// Pops the stale entries from the top of the queue.
+        /// @return Returns true if the queue still has entries.
+        bool drop_stale_entries()
+        {
+            if constexpr (!decrease_key_queue<priority_queue_type, node_type>)
+                while (!priority_open_set_.empty() && is_stale(priority_open_set_.top()))
+                    priority_open_set_.pop();
+
+            return !priority_open_set_.empty();
+        }
+
         void evaluate_neighbors()
         {
+            ++statistics_.expanded_nodes;
             priority_open_set_.pop();
-            open_set_.erase(node_);
-            closed_set_.insert(node_);
-            for (neighbor_enumerator_(node_); neighbor_enumerator_; ++neighbor_enumerator_)
-                if (closed_set_.find(*neighbor_enumerator_) == closed_set_.end())
+            mark_closed(node_);
+            if constexpr (batch_mode)
+                evaluate_neighbor_batch();
+            else if constexpr (parallel_mode)
+                evaluate_neighbor_candidates();
+            else
+                for (neighbor_enumerator_(node_); neighbor_enumerator_; ++neighbor_enumerator_)
+                    if (!is_closed(*neighbor_enumerator_))
+                        relax_neighbor(*neighbor_enumerator_, node_.general_score() + detail::edge_cost(neighbor_enumerator_, node_, *neighbor_enumerator_));
+        }
+
+        /// Opens the neighbor if it is new or the tentative general score improves its best known general score.
+        void relax_neighbor(node_type& neighbor, const typename node_type::score_type tentative_general_score)
+        {
+            if (!is_open(neighbor) || tentative_general_score < best_general_score(neighbor))
+                open_neighbor(neighbor, tentative_general_score);
+        }
+
+        /// Opens the neighbor with the tentative general score, unless the beam search drops it.
+        void open_neighbor(node_type& neighbor, const typename node_type::score_type tentative_general_score)
+        {
+            neighbor.set_general_score(tentative_general_score);
+            evaluate_heuristic(neighbor, tentative_general_score);
+            if (!beam_search_(neighbor, solution(), open_set_, priority_open_set_))
+            {
+                if constexpr (!dense_mode && requires { neighbor.id(); })
+                    if (!start_scores_.empty())
+                        start_scores_.erase(node_index {}(neighbor));
+
+                set_parent(neighbor, node_);
+                mark_open(neighbor);
+                push_open(neighbor);
+            }
+        }
+
+        /// Generates the candidate neighbors of a @ref parallel_enumerator on the executor, then relaxes them in
+        /// index order, so the search does not depend on the scheduling of the executor.
+        void evaluate_neighbor_candidates()
+        {
+            const std::size_t count = neighbor_enumerator_.candidate_count(node_);
+            candidates_.resize(count);
+            const auto generate = [](void* const context, const std::size_t index) {
+                auto& self = *static_cast<algo*>(context);
+                auto& item = self.candidates_[index];
+                const auto cost = std::as_const(self.neighbor_enumerator_).generate(std::as_const(self.node_), index, item.node);
+                item.valid = static_cast<bool>(cost);
+                if (item.valid)
+                    item.cost = *cost;
+            };
+
+            if (executor_ && count > 1)
+                executor_->parallel_for(count, generate, this);
+            else
+                for (std::size_t i = 0; i != count; ++i)
+                    generate(this, i);
+
+            for (auto& item: candidates_)
+                if (item.valid && !is_closed(item.node))
+                    relax_neighbor(item.node, node_.general_score() + item.cost);
+        }
+
+        /// Relaxes the neighbors of a @ref batch_enumerator: each neighbor is tested by id against the node table (a
+        /// single lookup covering the closed, open and unvisited states), so only the relaxed neighbors are
+        /// materialized, and the heuristic is evaluated only for them.
+        void evaluate_neighbor_batch()
+        {
+            using score_type = typename node_type::score_type;
+            const auto batch = neighbor_enumerator_.batch(node_);
+            const score_type general_score = node_.general_score();
+            for (std::size_t i = 0; i != batch.ids.size(); ++i)
+            {
+                // the limit is read right before relaxing, since the batch may hold the same node twice
+                const auto tentative = general_score + static_cast<score_type>(batch.costs[i]);
+                if (tentative < open_set_.relax_limit(batch.ids[i]))
+                    open_neighbor(neighbor_enumerator_.node(batch.ids[i]), tentative);
+            }
+        }
+
+        bool is_open(const node_type& node) const
+        {
+            if constexpr (dense_mode)
+                return open_set_.is_open(node);
+            else
+                return open_set_.find(node) != open_set_.end();
+        }
+
+        bool is_closed(const node_type& node) const
+        {
+            if constexpr (dense_mode)
+                return open_set_.is_closed(node);
+            else
+                return closed_set_.find(node) != closed_set_.end();
+        }
+
+        void mark_open(const node_type& node)
+        {
+            if constexpr (dense_mode)
+                open_set_.open(node, node.general_score());
+            else
+                open_set_.insert(node);
+        }
+
+        void mark_closed(const node_type& node)
+        {
+            if constexpr (dense_mode)
+                open_set_.close(node);
+            else
+            {
+                open_set_.erase(node);
+                closed_set_.insert(node);
+            }
+        }
+
+        void set_parent(const node_type& node, const node_type& parent)
+        {
+            if constexpr (dense_mode)
+                open_set_.set_parent(node, parent);
+            else
+                solution_[node] = parent;
+        }
+
+        /// Gets the best known general score of an open node.
+        auto best_general_score(const node_type& node) const
+        {
+            if constexpr (dense_mode)
+                return open_set_.general_score(node);
+            else
+            {
+                if constexpr (requires { node.id(); })
+                    if (!start_scores_.empty())
+                        if (const auto found = start_scores_.find(node_index {}(node)); found != start_scores_.end())
+                            return found->second;
+
+                return node.general_score();
+            }
+        }
+
+        void evaluate_heuristic(node_type& node, const typename node_type::score_type general_score)
+        {
+            if (target_nodes_.size() > 1)
+                evaluate_heuristic_aggregate(node, general_score);
+            else if constexpr (dense_mode)
+                detail::set_heuristic_score(open_set_, node, general_score, target_node_);
+            else
+                node.set_heuristic_score(general_score, target_node_);
+
+            if (epsilon_ != 1)
+                detail::inflate_heuristic_score(node, epsilon_);
+        }
+
+        /// Folds the heuristic scores of the node towards all the target nodes. The heuristic cache of a dense node
+        /// table is bypassed, since it keeps the scores towards a single target.
+        void evaluate_heuristic_aggregate(node_type& node, const typename node_type::score_type general_score)
+        {
+            node.set_heuristic_score(general_score, target_nodes_.front());
+            auto aggregate = node.heuristic_score();
+            for (auto target = std::next(target_nodes_.begin()); target != target_nodes_.end(); ++target)
+            {
+                node.set_heuristic_score(general_score, *target);
+                aggregate = heuristic_aggregate_(aggregate, node.heuristic_score());
+            }
+
+            detail::assign_heuristic_score(node, aggregate);
+        }
+
+        void open_start(node_type start_node)
+        {
+            attach_queue();
+            if constexpr (dense_mode && heuristic_cache_table<set_type, node_type>)
+                open_set_.set_heuristic_target(open_set_.index(target_node_));
+
+            start_node.set_general_score({});
+            evaluate_heuristic(start_node, 0);
+            mark_open(start_node);
+            priority_open_set_.push(std::move(start_node));
+        }
+
+        /// Opens all the start nodes with their own general scores; a start node given more than once keeps its
+        /// lowest general score.
+        void open_starts(const std::span<const node_type> start_nodes)
+        {
+            static_assert(dense_mode || requires(const node_type& node) { node.id(); },
+                          "the multi-source search without a node table needs the node ids");
+            attach_queue();
+            if constexpr (dense_mode && heuristic_cache_table<set_type, node_type>)
+                open_set_.set_heuristic_target(open_set_.index(target_node_));
+
+            for (auto start_node: start_nodes)
+            {
+                if (is_open(start_node) && !(start_node.general_score() < best_general_score(start_node)))
+                    continue;
+
+                // the nodes given by the neighbor enumerator do not carry the initial general score of a start node
+                // (they are other instances), so without a node table it is kept aside until a path improves it
+                if constexpr (!dense_mode)
+                    start_scores_[node_index {}(start_node)] = start_node.general_score();
+
+                evaluate_heuristic(start_node, start_node.general_score());
+                mark_open(start_node);
+                push_open(start_node);
+            }
+        }
+
+        /// Clears the containers keeping their memory, where they allow it.
+        void clear()
+        {
+            if constexpr (requires { priority_open_set_.clear(); })
+                priority_open_set_.clear();
+            else
+                while (!priority_open_set_.empty())
+                    priority_open_set_.pop();
+
+            open_set_.clear();
+            if constexpr (!dense_mode)
+            {
+                closed_set_.clear();
+                solution_.clear();
+                start_scores_.clear();
+            }
+
+            statistics_ = {};
+            has_solution_ = false;
+        }
+
+        /// Attaches the node table to a queue keeping its position handles in the table records.
+        void attach_queue() noexcept
+        {
+            if constexpr (requires { priority_open_set_.positions().attach(open_set_); })
+                priority_open_set_.positions().attach(open_set_);
+        }
+
+        /// Queues the node. A queue supporting decrease-key updates the entry of an already queued node instead of
+        /// keeping a stale duplicate of it.
+        void push_open(const node_type& node)
+        {
+            if constexpr (decrease_key_queue<priority_queue_type, node_type>)
+            {
+                if (priority_open_set_.contains(node))
                 {
-                    node_type& neighbor = *neighbor_enumerator_;
-                    const auto tentative_general_score = node_.general_score() + node_.distance_to(neighbor);
-                    const bool need_test = open_set_.find(neighbor) == open_set_.end();
-                    if (need_test || (tentative_general_score < neighbor.general_score()))
-                    {
-                        neighbor.set_general_score(tentative_general_score);
-                        neighbor.set_heuristic_score(tentative_general_score, target_node_);
-                        if (!beam_search_(neighbor, solution_, open_set_, priority_open_set_))
-                        {
-                            solution_[neighbor] = node_;
-                            open_set_.insert(neighbor);
-                            priority_open_set_.push(neighbor);
-                        }
-                    }
+                    priority_open_set_.decrease_key(node);
+                    return;
                 }
+            }
+
+            priority_open_set_.push(node);
         }
 
         solution_verifier_type solution_verifier_;
@@ -180,10 +932,242 @@ namespace stdext::astar
         neighbor_enumerator_type neighbor_enumerator_;
         priority_queue_type priority_open_set_;
         set_type open_set_;
-        set_type closed_set_;
-        solution_map_type solution_;
+        [[no_unique_address]] std::conditional_t<dense_mode, detail::unused_member, set_type> closed_set_;
+        [[no_unique_address]] std::conditional_t<dense_mode, detail::unused_member, solution_map_type> solution_;
+        [[no_unique_address]] std::conditional_t<parallel_mode, std::pmr::vector<detail::neighbor_candidate<node_type>>, detail::unused_member> candidates_;
         node_type node_;
         node_type target_node_;
+        /// Target nodes of a multi-target search; empty for a single target.
+        std::pmr::vector<node_type> target_nodes_;
+        /// Initial general scores of the start nodes of a multi-source search without a node table, by node id (see
+        /// @ref node_index); an entry is dropped once a path improves the start node.
+        [[no_unique_address]] std::conditional_t<dense_mode, detail::unused_member, std::pmr::unordered_map<std::size_t, typename node_type::score_type>>
+            start_scores_;
+        [[no_unique_address]] heuristic_aggregate_type heuristic_aggregate_;
+        search_statistics statistics_;
+        double epsilon_ = 1;
+        executor* executor_ {};
+        bool has_solution_ {};
+    };
+
+    /// @brief Bidirectional A* - a forward search from the start node and a backward search from the target node,
+    /// expanded in alternation, each one with its own _PriorityQueue and node table. The backward search enumerates
+    /// the predecessors (see @ref reverse_neighbor_enumerator) and estimates the distance to the start node.
+    /// The searches stop with the NBA* criterion: the best path found through a node reached by both searches is
+    /// optimal once it is not longer than the lowest total score of either open set. The nodes having the total score
+    /// not lower than the best path are closed without being expanded (NBA* pruning).
+    /// @note The heuristic has to be consistent in both directions.
+    /// @note _Set has to be a @ref node_table (e.g. @ref dense_node_table), since each search needs the general
+    /// scores of the other one. On success the path found by the backward search is spliced into the forward table,
+    /// so the solution is read like the one of @ref algo.
+    template <typename _Node, typename _PriorityQueue, typename _NeighborEnumerator, typename _ReverseNeighborEnumerator, typename _Set,
+              typename _SolutionMap = _Set>
+    class bidirectional_algo
+    {
+    public:
+        using node_type = _Node;
+        using score_type = typename node_type::score_type;
+        using priority_queue_type = _PriorityQueue;
+        using set_type = _Set;
+        using neighbor_enumerator_type = _NeighborEnumerator;
+        using reverse_neighbor_enumerator_type = _ReverseNeighborEnumerator;
+        using solution_map_type = _SolutionMap;
+
+        static_assert(node_table<set_type, node_type>, "the bidirectional search needs a node table as set");
+        static_assert(std::is_same_v<set_type, solution_map_type>, "the node table has to be also the solution map");
+        static_assert(reverse_neighbor_enumerator<reverse_neighbor_enumerator_type, node_type>);
+
+        /// @param[in] start_node Start node
+        /// @param[in] target_node Target node
+        /// @param[in] neighbor_enumerator Enumerator of the successors
+        /// @param[in] reverse_neighbor_enumerator Enumerator of the predecessors
+        bidirectional_algo(node_type start_node, node_type target_node, neighbor_enumerator_type neighbor_enumerator,
+                           reverse_neighbor_enumerator_type reverse_neighbor_enumerator):
+            forward_(std::move(neighbor_enumerator), target_node),
+            backward_(std::move(reverse_neighbor_enumerator), start_node)
+        {
+            attach_queues();
+            if constexpr (heuristic_cache_table<set_type, node_type>)
+            {
+                forward_.table.set_heuristic_target(forward_.table.index(target_node));
+                backward_.table.set_heuristic_target(backward_.table.index(start_node));
+            }
+
+            open(forward_, backward_, start_node, score_type {});
+            open(backward_, forward_, target_node, score_type {});
+        }
+
+        /// Checks if the solution was found.
+        bool has_solution() const noexcept { return has_solution_; }
+
+        /// Gets the cost of the best path found so far.
+        score_type cost() const noexcept { return best_cost_; }
+
+        /// Gets the solution - the forward node table, having the backward path spliced in once the solution is found.
+        const solution_map_type& solution() const noexcept { return forward_.table; }
+
+        /// Gets the last expanded node.
+        const node_type& node() const noexcept { return node_; }
+
+        /// Gets the search counters, cumulated for both directions.
+        const search_statistics& statistics() const noexcept { return statistics_; }
+
+        /// Progress method expanding one node of the forward or the backward search.
+        /// @return Returns true if the algorithm should continue. Otherwise @ref has_solution has to be checked.
+        bool operator()()
+        {
+            attach_queues();
+            const bool has_forward = drop_stale_entries(forward_);
+            const bool has_backward = drop_stale_entries(backward_);
+            if (!has_forward || !has_backward)
+                return finish(has_meeting_);
+
+            const auto lower_bound = std::max(forward_.queue.top().total_score(), backward_.queue.top().total_score());
+            if (has_meeting_ && best_cost_ <= lower_bound)
+                return finish(true);
+
+            forward_turn_ = !forward_turn_;
+            if (forward_turn_)
+                expand<true>(forward_, backward_);
+            else
+                expand<false>(backward_, forward_);
+
+            return true;
+        }
+
+    protected:
+        template <typename _Enumerator>
+        struct search
+        {
+            search(_Enumerator enumerator, node_type target_node): enumerator(std::move(enumerator)), target_node(std::move(target_node)) {}
+
+            _Enumerator enumerator;
+            priority_queue_type queue;
+            set_type table;
+            node_type target_node;
+        };
+
+        using forward_search = search<neighbor_enumerator_type>;
+        using backward_search = search<reverse_neighbor_enumerator_type>;
+
+        void attach_queues() noexcept
+        {
+            if constexpr (requires { forward_.queue.positions().attach(forward_.table); })
+            {
+                forward_.queue.positions().attach(forward_.table);
+                backward_.queue.positions().attach(backward_.table);
+            }
+        }
+
+        template <typename _Search>
+        bool drop_stale_entries(_Search& side)
+        {
+            if constexpr (!decrease_key_queue<priority_queue_type, node_type>)
+                while (!side.queue.empty())
+                {
+                    const node_type& top = side.queue.top();
+                    if (side.table.is_closed(top))
+                        ++statistics_.dropped_closed_entries;
+                    else if (side.table.general_score(top) < top.general_score())
+                        ++statistics_.dropped_superseded_entries;
+                    else
+                        break;
+
+                    side.queue.pop();
+                }
+
+            return !side.queue.empty();
+        }
+
+        /// Opens (or improves) the node in the given search and checks if it connects the two searches.
+        template <typename _Search, typename _Other>
+        void open(_Search& side, const _Other& other, node_type& node, const score_type general_score)
+        {
+            node.set_general_score(general_score);
+            detail::set_heuristic_score(side.table, node, general_score, side.target_node);
+            side.table.open(node, general_score);
+            if constexpr (decrease_key_queue<priority_queue_type, node_type>)
+                if (side.queue.contains(node))
+                {
+                    side.queue.decrease_key(node);
+                    return connect(other, node, general_score);
+                }
+
+            side.queue.push(node);
+            connect(other, node, general_score);
+        }
+
+        template <typename _Other>
+        void connect(const _Other& other, const node_type& node, const score_type general_score)
+        {
+            if (!other.table.is_open(node) && !other.table.is_closed(node))
+                return;
+
+            const auto cost = general_score + other.table.general_score(node);
+            if (!has_meeting_ || cost < best_cost_)
+            {
+                has_meeting_ = true;
+                best_cost_ = cost;
+                meeting_index_ = forward_.table.index(node);
+            }
+        }
+
+        template <bool _Forward, typename _Search, typename _Other>
+        void expand(_Search& side, const _Other& other)
+        {
+            node_ = side.queue.top();
+            side.queue.pop();
+            side.table.close(node_);
+            if (has_meeting_ && node_.total_score() >= best_cost_)
+                return;
+
+            ++statistics_.expanded_nodes;
+            for (side.enumerator(node_); side.enumerator; ++side.enumerator)
+            {
+                node_type& neighbor = *side.enumerator;
+                if (side.table.is_closed(neighbor))
+                    continue;
+
+                score_type cost;
+                if constexpr (_Forward)
+                    cost = detail::edge_cost(side.enumerator, node_, neighbor);
+                else
+                    cost = detail::edge_cost(side.enumerator, neighbor, node_);
+
+                const auto tentative_general_score = node_.general_score() + cost;
+                if (side.table.is_open(neighbor) && !(tentative_general_score < side.table.general_score(neighbor)))
+                    continue;
+
+                side.table.set_parent(neighbor, node_);
+                open(side, other, neighbor, tentative_general_score);
+            }
+        }
+
+        /// Ends the search, splicing the backward path into the forward table if a solution was found.
+        bool finish(const bool found)
+        {
+            if (found && !has_solution_)
+            {
+                auto child = meeting_index_;
+                for (auto parent = backward_.table.parent(child); parent != set_type::npos; parent = backward_.table.parent(parent))
+                {
+                    forward_.table.link(parent, child);
+                    child = parent;
+                }
+            }
+
+            has_solution_ = found;
+            return false;
+        }
+
+        forward_search forward_;
+        backward_search backward_;
+        node_type node_;
+        search_statistics statistics_;
+        score_type best_cost_ = std::numeric_limits<score_type>::max();
+        typename set_type::index_type meeting_index_ {};
+        bool has_meeting_ {};
         bool has_solution_ {};
+        bool forward_turn_ {};
     };
 } // namespace stdext::astar
@@ -0,0 +1,284 @@
+/// A* Anytime Repairing Search - ARA*
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_node_table.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <chrono>
+    #include <cstdint>
+    #include <limits>
+    #include <memory_resource>
+    #include <stop_token>
+    #include <utility>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Anytime Repairing A* (ARA*) - a series of weighted A* searches (see algo::set_epsilon) with a
+    /// decreasing inflation factor epsilon. The first search returns a path quickly, then each @ref improve call
+    /// lowers epsilon and repairs the previous search instead of starting over: the open nodes are kept (requeued
+    /// with the new epsilon) together with the inconsistent nodes - the nodes improved after being expanded in the
+    /// current search - and only these are expanded again. The search with epsilon 1 gives the optimal path.
+    /// @note Dense node table mode only, with a decrease-key priority queue (e.g. @ref dense_heap). In the table
+    /// the open state means queued, the closed state means visited but not queued; the nodes expanded by the
+    /// current search are tracked separately.
+    /// @note The solution verifier has to recognize the target node: a search ends when the target node is on top
+    /// of the queue, without expanding it.
+    template <typename _Node, typename _PriorityQueue, typename _NeighborEnumerator, typename _Table,
+              typename _SolutionVerifier = target_id_verifier>
+    class anytime_algo: public algo<_Node, _PriorityQueue, _NeighborEnumerator, _Table, _SolutionVerifier, _Table>
+    {
+    public:
+        using base_type = algo<_Node, _PriorityQueue, _NeighborEnumerator, _Table, _SolutionVerifier, _Table>;
+        using typename base_type::neighbor_enumerator_type;
+        using typename base_type::node_type;
+        using typename base_type::priority_queue_type;
+        using typename base_type::set_type;
+        using typename base_type::solution_verifier_type;
+        using score_type = typename node_type::score_type;
+
+        static_assert(base_type::dense_mode, "ARA* requires a node table");
+        static_assert(decrease_key_queue<priority_queue_type, node_type>, "ARA* requires a decrease-key priority queue");
+
+        /// @param[in] start_node Start node
+        /// @param[in] target_node Target node
+        /// @param[in] solution_verifier Verifier recognizing the target node
+        /// @param[in] neighbor_enumerator Enumerator of adjacent nodes
+        /// @param[in] epsilon Inflation factor of the first search
+        /// @param[in] epsilon_step Amount epsilon is lowered by on each @ref improve call
+        anytime_algo(node_type start_node, node_type target_node, solution_verifier_type solution_verifier,
+                     neighbor_enumerator_type neighbor_enumerator, const double epsilon = 3, const double epsilon_step = 0.5):
+            base_type(start_node, std::move(target_node), std::move(solution_verifier), std::move(neighbor_enumerator), {}),
+            initial_epsilon_(std::max(epsilon, 1.0)),
+            epsilon_step_(epsilon_step)
+        {
+            restart(std::move(start_node));
+        }
+
+        /// Prepares a new series of searches keeping the allocated memory (see algo::reset).
+        void reset(node_type start_node, node_type target_node)
+        {
+            base_type::reset(start_node, std::move(target_node));
+            restart(std::move(start_node));
+        }
+
+        /// Gets the cost of the best path found so far.
+        score_type cost() const noexcept { return this->open_set_.general_score(this->target_node_); }
+
+        /// Gets the suboptimality bound of the best path found so far: its cost is at most the bound times the
+        /// optimal cost. It is computed at the end of each search from the open and inconsistent nodes, so it may
+        /// be lower than epsilon; it is 1 for an optimal path and infinity before the first path is found.
+        double suboptimality_bound() const noexcept { return bound_; }
+
+        /// Checks if the current search is finished, i.e. the next step needs an @ref improve call.
+        bool is_finished() const noexcept { return finished_; }
+
+        /// Progress method expanding one node of the current search.
+        /// @return Returns true if the search should continue. Otherwise @ref has_solution has to be checked and
+        /// @ref improve starts the next search.
+        /// @note While a search runs, solution() keeps a valid path to the target node once one was found, whose
+        /// cost is at most @ref cost.
+        bool operator()()
+        {
+            if (finished_)
+                return false;
+
+            this->attach_queue();
+            if (this->priority_open_set_.empty())
+                return finish();
+
+            this->node_ = this->priority_open_set_.top();
+            if (this->solution_verifier_(this->node_))
+            {
+                this->has_solution_ = true;
+                return finish();
+            }
+
+            evaluate_neighbors();
+            return true;
+        }
+
+        /// Runs the current search to its end.
+        /// @return Returns has_solution().
+        bool search()
+        {
+            while ((*this)())
+            {
+            }
+
+            return this->has_solution_;
+        }
+
+        /// Starts the next search, lowering epsilon by the step down to 1. The open and inconsistent nodes are
+        /// requeued with the new epsilon, the other visited nodes keep their scores and parents.
+        /// @return Returns false if there is nothing to improve: no path was found, the path is already optimal or
+        /// the current search is not finished.
+        bool improve()
+        {
+            if (!finished_ || !this->has_solution_ || bound_ <= 1)
+                return false;
+
+            this->set_epsilon(std::max(this->epsilon_ - epsilon_step_, 1.0));
+            next_iteration();
+            this->attach_queue();
+            auto& queue = this->priority_open_set_;
+            auto& table = this->open_set_;
+            pending_.assign(queue.items().begin(), queue.items().end());
+            queue.clear();
+            for (const auto& node: inconsistent_)
+                if (!table.is_open(node))
+                {
+                    table.open(node, table.general_score(node));
+                    pending_.push_back(node);
+                }
+
+            inconsistent_.clear();
+            for (auto& node: pending_)
+            {
+                const auto general_score = table.general_score(node);
+                node.set_general_score(general_score);
+                this->evaluate_heuristic(node, general_score);
+                queue.push(node);
+            }
+
+            finished_ = false;
+            return true;
+        }
+
+        /// Runs at most count steps of the searches, starting the next search (see @ref improve) whenever one ends.
+        /// @return Returns true if the path can still be improved, false if it is optimal or no path exists.
+        bool run_steps(const std::size_t count)
+        {
+            const auto step = [this] { return (*this)() || improve(); };
+            return detail::run_steps(step, count);
+        }
+
+        /// Runs the searches until the time budget is spent or the path is optimal, e.g. a real-time planner gets
+        /// a path as soon as possible and then a better one in the remaining time. The clock is checked once per
+        /// check_interval expansions (see algo::run_for).
+        /// @return Returns true if the path can still be improved, false if it is optimal or no path exists.
+        bool run_for(const std::chrono::nanoseconds budget, const std::size_t check_interval = base_type::default_check_interval)
+        {
+            const auto step = [this] { return (*this)() || improve(); };
+            return detail::run_for(step, budget, check_interval);
+        }
+
+        /// Runs the searches until a stop is requested on the token or the path is optimal (see @ref run_for).
+        bool run_until(const std::stop_token token, const std::size_t check_interval = base_type::default_check_interval)
+        {
+            const auto step = [this] { return (*this)() || improve(); };
+            return detail::run_until(step, token, check_interval);
+        }
+
+    protected:
+        void restart(node_type start_node)
+        {
+            inconsistent_.clear();
+            next_iteration();
+            bound_ = std::numeric_limits<double>::infinity();
+            finished_ = false;
+
+            // the start node was queued by the base with the previous epsilon
+            this->set_epsilon(initial_epsilon_);
+            this->attach_queue();
+            this->priority_open_set_.clear();
+            start_node.set_general_score(score_type {});
+            this->evaluate_heuristic(start_node, score_type {});
+            this->open_set_.open(start_node, score_type {});
+            this->priority_open_set_.push(std::move(start_node));
+        }
+
+        bool finish()
+        {
+            finished_ = true;
+            if (this->has_solution_)
+                bound_ = std::min(this->epsilon_, compute_bound());
+
+            return false;
+        }
+
+        /// Computes the ratio between the cost of the path and the lowest uninflated total score of the open and
+        /// inconsistent nodes, which is a lower bound of the optimal cost.
+        double compute_bound()
+        {
+            auto lowest = std::numeric_limits<double>::infinity();
+            const auto evaluate = [&](node_type node) {
+                const auto general_score = this->open_set_.general_score(node);
+                detail::set_heuristic_score(this->open_set_, node, general_score, this->target_node_);
+                lowest = std::min(lowest, static_cast<double>(general_score) + static_cast<double>(node.heuristic_score()));
+            };
+
+            for (const auto& node: this->priority_open_set_.items())
+                evaluate(node);
+
+            for (const auto& node: inconsistent_)
+                evaluate(node);
+
+            const auto path_cost = static_cast<double>(cost());
+            return lowest > 0 ? std::max(path_cost / lowest, 1.0) : 1.0;
+        }
+
+        void evaluate_neighbors()
+        {
+            auto& table = this->open_set_;
+            auto& enumerator = this->neighbor_enumerator_;
+            const node_type& node = this->node_;
+            ++this->statistics_.expanded_nodes;
+            this->priority_open_set_.pop();
+            table.close(node);
+            expanded_stamp(table.index(node)) = iteration_;
+            for (enumerator(node); enumerator; ++enumerator)
+            {
+                node_type& neighbor = *enumerator;
+                const auto tentative_general_score = node.general_score() + detail::edge_cost(enumerator, node, neighbor);
+                const auto state = table.state(neighbor);
+                if (state != node_state::unvisited && !(tentative_general_score < table.general_score(neighbor)))
+                    continue;
+
+                neighbor.set_general_score(tentative_general_score);
+                table.set_parent(neighbor, node);
+                table.open(neighbor, tentative_general_score);
+                if (state == node_state::closed && expanded_stamp(table.index(neighbor)) == iteration_)
+                {
+                    // expanded by this search: it waits for the next one
+                    table.close(neighbor);
+                    inconsistent_.push_back(neighbor);
+                }
+                else
+                {
+                    this->evaluate_heuristic(neighbor, tentative_general_score);
+                    this->push_open(neighbor);
+                }
+            }
+        }
+
+        std::uint32_t& expanded_stamp(const std::size_t index)
+        {
+            if (index >= expanded_.size())
+                expanded_.resize(std::max(index + 1, expanded_.size() * 2));
+
+            return expanded_[index];
+        }
+
+        /// Starts a new search: the nodes expanded by the previous searches are no longer marked as expanded.
+        void next_iteration() noexcept
+        {
+            if (++iteration_ == 0)
+            {
+                std::fill(expanded_.begin(), expanded_.end(), std::uint32_t {});
+                iteration_ = 1;
+            }
+        }
+
+        double initial_epsilon_;
+        double epsilon_step_;
+        double bound_ = std::numeric_limits<double>::infinity();
+        std::pmr::vector<node_type> inconsistent_;
+        std::pmr::vector<node_type> pending_;
+        std::pmr::vector<std::uint32_t> expanded_;
+        std::uint32_t iteration_ {};
+        bool finished_ {};
+    };
+} // namespace stdext::astar
@@ -0,0 +1,52 @@
+/// A* Search Arena
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#ifndef PCH
+    #include <cstddef>
+    #include <memory>
+    #include <memory_resource>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Monotonic per query arena. The containers of an @ref algo created with @ref resource allocate by bumping
+    /// a pointer and never free individually; all memory is released in one shot by @ref release, once the algorithm
+    /// was destroyed. The initial buffer is owned by the arena and is reused by the next query, so a query fitting in
+    /// it does not touch the upstream resource at all.
+    /// @note The arena is not thread safe - use one arena per thread.
+    class search_arena
+    {
+    public:
+        static constexpr std::size_t default_capacity = 256 * 1024;
+
+        /// @param[in] capacity Size of the initial buffer.
+        /// @param[in] upstream Resource of the buffers allocated when the initial one is exhausted.
+        explicit search_arena(const std::size_t capacity = default_capacity,
+                              std::pmr::memory_resource* const upstream = std::pmr::get_default_resource()):
+            buffer_(std::make_unique_for_overwrite<std::byte[]>(capacity)),
+            capacity_(capacity),
+            resource_(buffer_.get(), capacity, upstream)
+        {
+        }
+
+        search_arena(const search_arena&) = delete;
+        search_arena& operator=(const search_arena&) = delete;
+
+        /// Gets the memory resource to be passed to the algorithm.
+        std::pmr::memory_resource* resource() noexcept { return &resource_; }
+
+        /// Gets the size of the initial buffer.
+        std::size_t capacity() const noexcept { return capacity_; }
+
+        /// Releases all memory allocated since the creation or the last release. The buffers allocated from the
+        /// upstream resource are freed and the initial buffer is reused.
+        /// @warning The containers which allocated from the arena have to be destroyed before.
+        void release() noexcept { resource_.release(); }
+
+    private:
+        std::unique_ptr<std::byte[]> buffer_;
+        std::size_t capacity_;
+        std::pmr::monotonic_buffer_resource resource_;
+    };
+} // namespace stdext::astar
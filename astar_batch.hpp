@@ -0,0 +1,132 @@
+/// A* Batch Query Solver
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_arena.hpp"
+#include "astar_thread_pool.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <concepts>
+    #include <cstddef>
+    #include <functional>
+    #include <limits>
+    #include <memory_resource>
+    #include <optional>
+    #include <span>
+    #include <utility>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Runs many independent queries on a shared read-only graph across a @ref work_stealing_pool. Each worker
+    /// keeps its own algorithm instance, created on its first query from a @ref search_arena of its own and reused
+    /// by the next queries with reset(start, target), so after the first queries the workers neither allocate nor
+    /// share any mutable state. The queries are split in chunks which the idle workers steal from the busy ones.
+    /// @note The factory creates the algorithm from (start node, target node, memory resource), e.g. a @ref csr_algo
+    /// sharing a @ref csr_view: the graph and the enumerator data have to be safe to read from several threads.
+    template <typename _Algo>
+    class batch_solver
+    {
+    public:
+        using algo_type = _Algo;
+        using node_type = typename algo_type::node_type;
+        using score_type = typename node_type::score_type;
+        using factory_type = std::function<algo_type(const node_type& start_node, const node_type& target_node, std::pmr::memory_resource* resource)>;
+
+        /// Start and target nodes of a query.
+        struct query
+        {
+            node_type start_node;
+            node_type target_node;
+        };
+
+        /// Outcome of a query.
+        struct result
+        {
+            /// Cost of the path; meaningful only if the path was found.
+            score_type cost {};
+            std::size_t expanded_nodes {};
+            bool found {};
+        };
+
+        /// @param[in] pool Thread pool running the queries; it has to outlive the solver
+        /// @param[in] factory Creator of the algorithm instances of the workers
+        /// @param[in] arena_capacity Size of the initial buffer of the arena of each worker
+        batch_solver(work_stealing_pool& pool, factory_type factory, const std::size_t arena_capacity = search_arena::default_capacity):
+            pool_(&pool),
+            factory_(std::move(factory)),
+            arena_capacity_(arena_capacity),
+            workers_(pool.size())
+        {
+        }
+
+        /// Runs the queries and calls visit(query index, algorithm) on the worker thread after each query, e.g. to
+        /// copy the path out of algorithm.solution(). The calls for different queries may be concurrent.
+        /// @param[in] chunk_size Number of queries of a task; 0 picks a size giving about 8 tasks per worker
+        template <typename _Visitor>
+            requires std::invocable<_Visitor&, std::size_t, algo_type&>
+        void solve(const std::span<const query> queries, _Visitor&& visit, std::size_t chunk_size = 0)
+        {
+            if (chunk_size == 0)
+                chunk_size = std::max<std::size_t>(queries.size() / (workers_.size() * 8), 1);
+
+            for (std::size_t first = 0; first < queries.size(); first += chunk_size)
+            {
+                const auto last = std::min(first + chunk_size, queries.size());
+                pool_->submit([this, queries, &visit, first, last](const std::size_t worker) {
+                    for (auto i = first; i != last; ++i)
+                        visit(i, run(worker, queries[i]));
+                });
+            }
+
+            pool_->wait();
+        }
+
+        /// Runs the queries and gets their results, in the order of the queries.
+        std::vector<result> solve(const std::span<const query> queries, const std::size_t chunk_size = 0)
+        {
+            std::vector<result> results(queries.size());
+            solve(
+                queries,
+                [&results](const std::size_t index, const algo_type& algo) {
+                    auto& item = results[index];
+                    item.found = algo.has_solution();
+                    item.expanded_nodes = algo.statistics().expanded_nodes;
+                    if (item.found)
+                        item.cost = algo.node().general_score();
+                },
+                chunk_size);
+            return results;
+        }
+
+    private:
+        /// State of a worker, aligned to a cache line so the workers do not share one.
+        struct alignas(64) worker_state
+        {
+            std::optional<search_arena> arena;
+            std::optional<algo_type> algo;
+        };
+
+        algo_type& run(const std::size_t worker, const query& item)
+        {
+            auto& state = workers_[worker];
+            if (!state.algo)
+            {
+                state.arena.emplace(arena_capacity_);
+                state.algo.emplace(factory_(item.start_node, item.target_node, state.arena->resource()));
+            }
+            else
+                state.algo->reset(item.start_node, item.target_node);
+
+            auto& algo = *state.algo;
+            algo.run_steps(std::numeric_limits<std::size_t>::max());
+            return algo;
+        }
+
+        work_stealing_pool* pool_;
+        factory_type factory_;
+        std::size_t arena_capacity_;
+        std::vector<worker_state> workers_;
+    };
+} // namespace stdext::astar
@@ -0,0 +1,269 @@
+/// A* Memory-Mapped CSR Graph File
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_csr_graph.hpp"
+#if __has_include(<sys/mman.h>)
+    #define ASTAR_HAS_MMAP 1
+#endif
+#ifndef PCH
+    #include <cerrno>
+    #include <cstdint>
+    #include <cstring>
+    #include <fstream>
+    #include <ios>
+    #include <limits>
+    #include <stdexcept>
+    #include <string>
+    #include <system_error>
+    #include <type_traits>
+    #include <utility>
+    #ifdef ASTAR_HAS_MMAP
+        #include <fcntl.h>
+        #include <sys/mman.h>
+        #include <sys/stat.h>
+        #include <unistd.h>
+    #endif
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Header of the binary CSR graph file. The header is followed by the offsets, targets, weights and the
+    /// optional coordinates arrays of a @ref csr_view, each one starting at a 64-byte aligned file offset, stored in
+    /// the native byte order. A mapped file is used in place, without deserialization.
+    struct csr_file_header
+    {
+        static constexpr char signature[8] = {'A', 'S', 'T', 'A', 'R', 'C', 'S', 'R'};
+        static constexpr std::uint32_t current_version = 1;
+        static constexpr std::uint32_t native_byte_order = 0x01020304;
+        static constexpr std::uint64_t alignment = 64;
+
+        /// Kind of the weight type.
+        enum weight_kind : std::uint32_t
+        {
+            signed_integral,
+            unsigned_integral,
+            floating_point
+        };
+
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t byte_order;
+        std::uint32_t index_size;
+        std::uint32_t weight_size;
+        std::uint32_t weight_kind;
+        std::uint32_t reserved;
+        std::uint64_t node_count;
+        std::uint64_t edge_count;
+        std::uint64_t offsets_offset;
+        std::uint64_t targets_offset;
+        std::uint64_t weights_offset;
+        /// File offset of the coordinates, or 0 if the graph has none.
+        std::uint64_t coordinates_offset;
+        std::uint64_t file_size;
+
+        template <typename _Weight>
+        static constexpr std::uint32_t kind_of() noexcept
+        {
+            return std::is_floating_point_v<_Weight> ? floating_point : std::is_signed_v<_Weight> ? signed_integral : unsigned_integral;
+        }
+    };
+
+    namespace detail
+    {
+        constexpr std::uint64_t align_offset(const std::uint64_t offset) noexcept
+        {
+            return (offset + csr_file_header::alignment - 1) / csr_file_header::alignment * csr_file_header::alignment;
+        }
+
+        template <typename _Item>
+        void write_section(std::ofstream& file, const std::uint64_t offset, const std::span<const _Item> items)
+        {
+            file.seekp(static_cast<std::streamoff>(offset));
+            file.write(reinterpret_cast<const char*>(items.data()), static_cast<std::streamsize>(items.size_bytes()));
+        }
+    } // namespace detail
+
+    /// Writes the graph to a binary CSR file (see @ref csr_file_header).
+    /// @throw std::system_error if the file cannot be written.
+    template <typename _Weight, typename _Index>
+    void write_csr_file(const std::string& path, const csr_view<_Weight, _Index>& graph)
+    {
+        csr_file_header header {};
+        std::memcpy(header.magic, csr_file_header::signature, sizeof(header.magic));
+        header.version = csr_file_header::current_version;
+        header.byte_order = csr_file_header::native_byte_order;
+        header.index_size = sizeof(_Index);
+        header.weight_size = sizeof(_Weight);
+        header.weight_kind = csr_file_header::kind_of<_Weight>();
+        header.node_count = graph.node_count();
+        header.edge_count = graph.edge_count();
+        header.offsets_offset = detail::align_offset(sizeof(csr_file_header));
+        header.targets_offset = detail::align_offset(header.offsets_offset + graph.offsets().size_bytes());
+        header.weights_offset = detail::align_offset(header.targets_offset + graph.targets().size_bytes());
+        std::uint64_t end = header.weights_offset + graph.weights().size_bytes();
+        if (graph.has_coordinates())
+        {
+            header.coordinates_offset = detail::align_offset(end);
+            end = header.coordinates_offset + graph.coordinates().size_bytes();
+        }
+
+        header.file_size = end;
+
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            throw std::system_error(std::make_error_code(std::io_errc::stream), "cannot create " + path);
+
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        detail::write_section(file, header.offsets_offset, graph.offsets());
+        detail::write_section(file, header.targets_offset, graph.targets());
+        detail::write_section(file, header.weights_offset, graph.weights());
+        if (graph.has_coordinates())
+            detail::write_section(file, header.coordinates_offset, graph.coordinates());
+
+        file.flush();
+        if (!file)
+            throw std::system_error(std::make_error_code(std::io_errc::stream), "cannot write " + path);
+    }
+
+#ifdef ASTAR_HAS_MMAP
+    /// @brief Read-only memory mapping of a binary CSR graph file (see @ref write_csr_file). The @ref view refers
+    /// directly to the mapped pages, so opening the graph costs only the validation of the header, and the processes
+    /// mapping the same file share its page cache.
+    /// @note The layout and the offsets are validated (the offsets are checked to be monotone, so an enumerator stays
+    /// within the edges), but not the edge targets, so the file has to come from a trusted writer.
+    template <typename _Weight = float, typename _Index = std::uint32_t>
+    class mapped_csr_graph
+    {
+    public:
+        using weight_type = _Weight;
+        using index_type = _Index;
+        using view_type = csr_view<weight_type, index_type>;
+
+        /// Maps the file.
+        /// @throw std::system_error if the file cannot be mapped and std::runtime_error if it is not a valid CSR
+        /// file of the given weight and index types.
+        explicit mapped_csr_graph(const std::string& path)
+        {
+            const int descriptor = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (descriptor < 0)
+                throw std::system_error(errno, std::generic_category(), "cannot open " + path);
+
+            struct stat status {};
+            if (::fstat(descriptor, &status) != 0)
+            {
+                const int error = errno;
+                ::close(descriptor);
+                throw std::system_error(error, std::generic_category(), "cannot stat " + path);
+            }
+
+            size_ = static_cast<std::size_t>(status.st_size);
+            data_ = size_ != 0 ? ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, descriptor, 0) : MAP_FAILED;
+            const int error = errno;
+            ::close(descriptor);
+            if (data_ == MAP_FAILED)
+            {
+                data_ = nullptr;
+                throw std::system_error(size_ != 0 ? error : EINVAL, std::generic_category(), "cannot map " + path);
+            }
+
+            try
+            {
+                validate();
+            }
+            catch (...)
+            {
+                unmap();
+                throw;
+            }
+        }
+
+        mapped_csr_graph(mapped_csr_graph&& other) noexcept:
+            data_(std::exchange(other.data_, nullptr)),
+            size_(std::exchange(other.size_, 0)),
+            view_(std::exchange(other.view_, {}))
+        {
+        }
+
+        mapped_csr_graph& operator=(mapped_csr_graph&& other) noexcept
+        {
+            if (this != &other)
+            {
+                unmap();
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+                view_ = std::exchange(other.view_, {});
+            }
+
+            return *this;
+        }
+
+        mapped_csr_graph(const mapped_csr_graph&) = delete;
+        mapped_csr_graph& operator=(const mapped_csr_graph&) = delete;
+
+        ~mapped_csr_graph() { unmap(); }
+
+        const csr_file_header& header() const noexcept { return *static_cast<const csr_file_header*>(data_); }
+
+        const view_type& view() const noexcept { return view_; }
+        operator const view_type&() const noexcept { return view_; }
+
+    private:
+        template <typename _Item>
+        std::span<const _Item> section(const std::uint64_t offset, const std::uint64_t count) const
+        {
+            if (offset % alignof(_Item) != 0 || offset > size_ || count > (size_ - offset) / sizeof(_Item))
+                throw std::runtime_error("CSR file section out of bounds");
+
+            return {reinterpret_cast<const _Item*>(static_cast<const char*>(data_) + offset), static_cast<std::size_t>(count)};
+        }
+
+        void validate()
+        {
+            if (size_ < sizeof(csr_file_header))
+                throw std::runtime_error("CSR file too small");
+
+            const auto& item = header();
+            if (std::memcmp(item.magic, csr_file_header::signature, sizeof(item.magic)) != 0 || item.version != csr_file_header::current_version)
+                throw std::runtime_error("not a CSR file or unsupported version");
+
+            if (item.byte_order != csr_file_header::native_byte_order || item.index_size != sizeof(index_type) ||
+                item.weight_size != sizeof(weight_type) || item.weight_kind != csr_file_header::kind_of<weight_type>())
+                throw std::runtime_error("CSR file types do not match");
+
+            if (item.file_size > size_)
+                throw std::runtime_error("CSR file truncated");
+
+            // the node ids and the edge offsets are index_type values (this also keeps node_count + 1 from wrapping)
+            constexpr auto max_index = static_cast<std::uint64_t>(std::numeric_limits<index_type>::max());
+            if (item.node_count > max_index || item.edge_count > max_index)
+                throw std::runtime_error("CSR file too large for its index type");
+
+            const auto offsets = section<index_type>(item.offsets_offset, item.node_count + 1);
+            if (offsets.front() != 0 || offsets.back() != item.edge_count)
+                throw std::runtime_error("CSR file offsets do not match the edges");
+
+            for (std::size_t i = 1; i != offsets.size(); ++i)
+                if (offsets[i] < offsets[i - 1])
+                    throw std::runtime_error("CSR file offsets are not monotone");
+
+            view_ = view_type(offsets, section<index_type>(item.targets_offset, item.edge_count),
+                              section<weight_type>(item.weights_offset, item.edge_count),
+                              item.coordinates_offset != 0 ? section<csr_point>(item.coordinates_offset, item.node_count) : std::span<const csr_point> {});
+        }
+
+        void unmap() noexcept
+        {
+            if (data_)
+                ::munmap(data_, size_);
+
+            data_ = nullptr;
+            size_ = 0;
+        }
+
+        void* data_ {};
+        std::size_t size_ {};
+        view_type view_;
+    };
+#endif
+} // namespace stdext::astar
@@ -0,0 +1,278 @@
+/// A* Compressed Sparse Row Graph
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_node_table.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <cmath>
+    #include <cstdint>
+    #include <iterator>
+    #include <memory_resource>
+    #include <span>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// Planar coordinates of a graph node, used by the heuristic.
+    struct csr_point
+    {
+        float x, y;
+    };
+
+    /// @brief Non-owning Compressed Sparse Row view of a directed graph: the outgoing edges of node i are the
+    /// entries [offsets[i], offsets[i + 1]) of the targets and weights arrays. The coordinates are optional.
+    /// @note The view may refer to a @ref csr_graph or to any other storage, e.g. a memory-mapped file.
+    template <typename _Weight = float, typename _Index = std::uint32_t>
+    class csr_view
+    {
+    public:
+        using weight_type = _Weight;
+        using index_type = _Index;
+
+        csr_view() = default;
+
+        csr_view(std::span<const index_type> offsets, std::span<const index_type> targets, std::span<const weight_type> weights,
+                 std::span<const csr_point> coordinates = {}) noexcept:
+            offsets_(offsets),
+            targets_(targets),
+            weights_(weights),
+            coordinates_(coordinates)
+        {
+        }
+
+        std::size_t node_count() const noexcept { return offsets_.empty() ? 0 : offsets_.size() - 1; }
+        std::size_t edge_count() const noexcept { return targets_.size(); }
+
+        bool has_coordinates() const noexcept { return !coordinates_.empty(); }
+
+        /// Gets the targets of the outgoing edges of the node.
+        std::span<const index_type> targets(const index_type node) const noexcept
+        {
+            return targets_.subspan(offsets_[node], offsets_[node + 1] - offsets_[node]);
+        }
+
+        /// Gets the weights of the outgoing edges of the node, parallel to @ref targets.
+        std::span<const weight_type> weights(const index_type node) const noexcept
+        {
+            return weights_.subspan(offsets_[node], offsets_[node + 1] - offsets_[node]);
+        }
+
+        const csr_point& coordinates(const index_type node) const noexcept { return coordinates_[node]; }
+
+        std::span<const index_type> offsets() const noexcept { return offsets_; }
+        std::span<const index_type> targets() const noexcept { return targets_; }
+        std::span<const weight_type> weights() const noexcept { return weights_; }
+        std::span<const csr_point> coordinates() const noexcept { return coordinates_; }
+
+    private:
+        std::span<const index_type> offsets_;
+        std::span<const index_type> targets_;
+        std::span<const weight_type> weights_;
+        std::span<const csr_point> coordinates_;
+    };
+
+    /// @brief Compressed Sparse Row graph owning its arrays. The adjacency of all nodes is kept in three contiguous
+    /// arrays instead of a container per node, so loading and traversing the graph touches few cache lines.
+    template <typename _Weight = float, typename _Index = std::uint32_t>
+    class csr_graph
+    {
+    public:
+        using weight_type = _Weight;
+        using index_type = _Index;
+        using view_type = csr_view<weight_type, index_type>;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        /// Directed weighted edge.
+        struct edge
+        {
+            index_type from, to;
+            weight_type weight;
+        };
+
+        explicit csr_graph(const allocator_type& allocator = {}):
+            offsets_(1, index_type {}, allocator), targets_(allocator), weights_(allocator), coordinates_(allocator)
+        {
+        }
+
+        /// Builds the graph from an edge list in any order. The edges of the same node keep their relative order.
+        /// @param[in] node_count Number of nodes, having the ids [0, node_count)
+        /// @param[in] edges Range of @ref edge
+        template <typename _Edges>
+        csr_graph(const std::size_t node_count, const _Edges& edges, const allocator_type& allocator = {}):
+            offsets_(node_count + 1, index_type {}, allocator), targets_(allocator), weights_(allocator), coordinates_(allocator)
+        {
+            for (const edge& item: edges)
+                ++offsets_[item.from + 1];
+
+            for (std::size_t i = 1; i != offsets_.size(); ++i)
+                offsets_[i] += offsets_[i - 1];
+
+            targets_.resize(offsets_.back());
+            weights_.resize(offsets_.back());
+            std::pmr::vector<index_type> next(offsets_.begin(), offsets_.end() - 1, allocator);
+            for (const edge& item: edges)
+            {
+                const auto position = next[item.from]++;
+                targets_[position] = item.to;
+                weights_[position] = item.weight;
+            }
+        }
+
+        /// Sets the coordinates of the nodes used by the heuristic of @ref csr_node.
+        template <typename _Points>
+        void set_coordinates(const _Points& coordinates)
+        {
+            coordinates_.assign(std::begin(coordinates), std::end(coordinates));
+        }
+
+        std::size_t node_count() const noexcept { return offsets_.size() - 1; }
+        std::size_t edge_count() const noexcept { return targets_.size(); }
+
+        view_type view() const noexcept { return {offsets_, targets_, weights_, coordinates_}; }
+        operator view_type() const noexcept { return view(); }
+
+    private:
+        std::pmr::vector<index_type> offsets_;
+        std::pmr::vector<index_type> targets_;
+        std::pmr::vector<weight_type> weights_;
+        std::pmr::vector<csr_point> coordinates_;
+    };
+
+    /// Builds the reverse (transposed) graph - the graph having all the edges of the given one reversed - keeping the
+    /// coordinates. The reverse graph enumerates the predecessors, e.g. for a backward search.
+    template <typename _Weight, typename _Index>
+    csr_graph<_Weight, _Index> make_reverse_graph(const csr_view<_Weight, _Index>& graph, const std::pmr::polymorphic_allocator<std::byte>& allocator = {})
+    {
+        using graph_type = csr_graph<_Weight, _Index>;
+        std::vector<typename graph_type::edge> edges;
+        edges.reserve(graph.edge_count());
+        for (_Index from = 0; from != graph.node_count(); ++from)
+        {
+            const auto targets = graph.targets(from);
+            const auto weights = graph.weights(from);
+            for (std::size_t i = 0; i != targets.size(); ++i)
+                edges.push_back({targets[i], from, weights[i]});
+        }
+
+        graph_type result(graph.node_count(), edges, allocator);
+        result.set_coordinates(graph.coordinates());
+        return result;
+    }
+
+    /// @brief Node of a @ref csr_view graph, holding only the node id besides the scores; the edge weights are
+    /// given by @ref csr_enumerator (see @ref weighted_enumerator). The heuristic is the Euclidean distance of the
+    /// coordinates scaled by heuristic_scale (0 when the graph has no coordinates, which makes the search a Dijkstra
+    /// search).
+    /// @note The heuristic is admissible only if no edge is shorter than the scaled distance of its ends.
+    /// @note The node refers to the graph view, which has to outlive it.
+    template <typename _Score = float, typename _Index = std::uint32_t>
+    class csr_node: public base_node<_Score>
+    {
+    public:
+        using score_type = _Score;
+        using index_type = _Index;
+        using base_type = base_node<score_type>;
+        using view_type = csr_view<score_type, index_type>;
+
+        csr_node() = default;
+
+        csr_node(const view_type& graph, const index_type id, const float heuristic_scale = 1) noexcept:
+            graph_(&graph),
+            id_(id),
+            heuristic_scale_(heuristic_scale)
+        {
+        }
+
+        /// The node keeps a pointer to the view, so it cannot be built from a temporary one (e.g. converted from a
+        /// @ref csr_graph).
+        csr_node(view_type&& graph, index_type id, float heuristic_scale = 1) = delete;
+
+        operator int() const noexcept { return static_cast<int>(id_); }
+
+        index_type id() const noexcept { return id_; }
+
+        void set_heuristic_score(score_type, const csr_node& target_node) noexcept
+        {
+            if (!graph_->has_coordinates())
+                return base_type::set_heuristic_score(score_type {});
+
+            const auto& from = graph_->coordinates(id_);
+            const auto& to = graph_->coordinates(target_node.id_);
+            base_type::set_heuristic_score(static_cast<score_type>(heuristic_scale_ * std::hypot(to.x - from.x, to.y - from.y)));
+        }
+
+        /// Changes the node id, keeping the graph and the heuristic scale.
+        void set_id(const index_type id) noexcept { id_ = id; }
+
+    protected:
+        const view_type* graph_ {};
+        index_type id_ {};
+        float heuristic_scale_ = 1;
+    };
+
+    /// @brief Zero-allocation neighbor enumerator of a @ref csr_view graph. It streams the contiguous targets of the
+    /// node, stamping their ids into a single node (a copy of the prototype given at construction), and yields the
+    /// stored edge weights through @ref cost. It is also a @ref batch_enumerator handing over the whole adjacency.
+    template <typename _Node = csr_node<>>
+    class csr_enumerator
+    {
+    public:
+        using node_type = _Node;
+        using index_type = typename node_type::index_type;
+        using view_type = typename node_type::view_type;
+
+        /// @param[in] graph Graph view; it has to outlive the enumerator
+        /// @param[in] prototype Node copied for the enumerated neighbors
+        csr_enumerator(const view_type& graph, node_type prototype) noexcept: graph_(&graph), node_(std::move(prototype)) {}
+
+        explicit csr_enumerator(const view_type& graph) noexcept: csr_enumerator(graph, node_type(graph, 0)) {}
+
+        /// The enumerator keeps a pointer to the view, so it cannot be built from a temporary one.
+        csr_enumerator(view_type&& graph, node_type prototype) = delete;
+        explicit csr_enumerator(view_type&& graph) = delete;
+
+        operator bool() const noexcept { return position_ != end_; }
+
+        void operator()(const node_type& node) noexcept
+        {
+            const auto offsets = graph_->offsets();
+            position_ = offsets[node.id()];
+            end_ = offsets[node.id() + 1];
+        }
+
+        void operator++() noexcept { ++position_; }
+
+        node_type& operator*() noexcept
+        {
+            node_.set_id(graph_->targets()[position_]);
+            return node_;
+        }
+
+        /// Gets the weight of the edge to the current neighbor.
+        auto cost() const noexcept { return graph_->weights()[position_]; }
+
+        /// Gets all the neighbors of the node at once (see @ref batch_enumerator).
+        neighbor_batch<index_type, typename view_type::weight_type> batch(const node_type& node) const noexcept
+        {
+            return {graph_->targets(node.id()), graph_->weights(node.id())};
+        }
+
+        /// Gets the node having the given id, stamped into the enumerated node.
+        node_type& node(const index_type id) noexcept
+        {
+            node_.set_id(id);
+            return node_;
+        }
+
+    private:
+        const view_type* graph_;
+        node_type node_;
+        index_type position_ {}, end_ {};
+    };
+
+    /// A* algorithm on a @ref csr_view graph, with a @ref dense_node_table as open set, closed set and solution map.
+    template <typename _Score = float, typename _Table = dense_node_table<_Score>>
+    using csr_algo = algo<csr_node<_Score>, dense_heap<csr_node<_Score>, _Table>, csr_enumerator<csr_node<_Score>>, _Table, target_id_verifier, _Table>;
+} // namespace stdext::astar
@@ -0,0 +1,323 @@
+/// A* Incremental Replanning - D* Lite
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_priority_queue.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <compare>
+    #include <cstdint>
+    #include <limits>
+    #include <memory_resource>
+    #include <unordered_map>
+    #include <utility>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief D* Lite - incremental A* searching from the target node towards the start node. The general scores (g)
+    /// and the one-step lookahead scores (rhs) are kept between the searches, so after an edge cost change
+    /// (@ref update_edge_cost) or a start node move (@ref set_start) the replanning touches only the nodes whose
+    /// scores are affected by the change. Without changes it behaves like LPA* with a fixed start.
+    /// @note The heuristic (set_heuristic_score(general_score, target_node)) is evaluated towards the start node, so
+    /// it has to be consistent and to work in both directions, as for @ref bidirectional_algo.
+    /// @note The edge costs are given by the enumerator (see @ref weighted_enumerator) or by distance_to of the nodes,
+    /// unless they are overridden by @ref update_edge_cost. The @ref infinity cost blocks an edge.
+    template <typename _Node, typename _NeighborEnumerator, typename _ReverseNeighborEnumerator = _NeighborEnumerator,
+              typename _NodeIndex = node_index>
+    class dstar_lite
+    {
+    public:
+        using node_type = _Node;
+        using score_type = typename node_type::score_type;
+        using neighbor_enumerator_type = _NeighborEnumerator;
+        using reverse_neighbor_enumerator_type = _ReverseNeighborEnumerator;
+        using node_index_type = _NodeIndex;
+        using index_type = std::uint32_t;
+
+        static_assert(neighbor_enumerator<neighbor_enumerator_type, node_type>);
+        static_assert(reverse_neighbor_enumerator<reverse_neighbor_enumerator_type, node_type>);
+
+        static constexpr index_type npos = ~index_type {};
+        static constexpr score_type infinity = std::numeric_limits<score_type>::max();
+
+        /// @param[in] start_node Start node
+        /// @param[in] target_node Target node
+        /// @param[in] neighbor_enumerator Enumerator of the successors
+        /// @param[in] reverse_neighbor_enumerator Enumerator of the predecessors
+        dstar_lite(node_type start_node, node_type target_node, neighbor_enumerator_type neighbor_enumerator,
+                   reverse_neighbor_enumerator_type reverse_neighbor_enumerator, node_index_type node_index = {}):
+            neighbor_enumerator_(std::move(neighbor_enumerator)),
+            reverse_neighbor_enumerator_(std::move(reverse_neighbor_enumerator)),
+            node_index_(std::move(node_index)),
+            start_node_(std::move(start_node)),
+            last_start_node_(start_node_),
+            target_node_(std::move(target_node))
+        {
+            const auto target = fetch(target_node_);
+            records_[target].rhs = score_type {};
+            queue_.push({target, key(target)});
+        }
+
+        /// Checks if a path from the start node to the target node is known, i.e. the last search is complete and
+        /// the start node is reachable.
+        bool has_solution() const noexcept { return !is_pending() && general_score(start_node_) != infinity; }
+
+        /// Gets the cost of the path from the start node, or @ref infinity if the target is unreachable.
+        score_type cost() const noexcept { return general_score(start_node_); }
+
+        /// Gets the general score (g) of the node - its distance to the target node, or @ref infinity if unknown.
+        score_type general_score(const node_type& node) const noexcept
+        {
+            const auto index = node_index_(node);
+            return index < records_.size() ? records_[index].general_score : infinity;
+        }
+
+        /// Gets the search counters, cumulated over all searches.
+        const search_statistics& statistics() const noexcept { return statistics_; }
+
+        /// Progress method processing one queue entry of the current search.
+        /// @return Returns true if the search should continue. Otherwise @ref has_solution has to be checked.
+        bool operator()()
+        {
+            if (!is_pending())
+                return false;
+
+            const auto [index, old_key] = queue_.top();
+            const auto new_key = key(index);
+            if (old_key < new_key)
+            {
+                queue_.push({index, new_key});
+                return true;
+            }
+
+            ++statistics_.expanded_nodes;
+            queue_.pop();
+            auto& item = records_[index];
+            const node_type node = item.node;
+            if (item.general_score > item.rhs)
+                item.general_score = item.rhs;
+            else
+            {
+                item.general_score = infinity;
+                update_node(index);
+            }
+
+            for (reverse_neighbor_enumerator_(node); reverse_neighbor_enumerator_; ++reverse_neighbor_enumerator_)
+                update_node(fetch(*reverse_neighbor_enumerator_));
+
+            return true;
+        }
+
+        /// Runs the search until the path of the start node is consistent.
+        /// @return Returns @ref has_solution.
+        bool compute_shortest_path()
+        {
+            while ((*this)())
+            {
+            }
+
+            return has_solution();
+        }
+
+        /// Moves the start node, e.g. after the agent advanced on the path. The queue keys are kept valid by raising
+        /// the key modifier with the heuristic distance between the old and the new start nodes.
+        void set_start(node_type start_node)
+        {
+            start_node_ = std::move(start_node);
+            key_modifier_ += heuristic(last_start_node_, start_node_);
+            last_start_node_ = start_node_;
+        }
+
+        /// Changes the cost of the edge from node to neighbor and updates the node. Call it for both directions on
+        /// undirected graphs. The next search repairs only the scores affected by the change.
+        void update_edge_cost(const node_type& node, const node_type& neighbor, const score_type cost)
+        {
+            const auto index = fetch(node);
+            edge_costs_[edge_key(index, static_cast<index_type>(node_index_(neighbor)))] = cost;
+            update_node(index);
+        }
+
+        /// Gets the cost of the edge from node to neighbor used by the planner: the overridden cost, otherwise the
+        /// cost given by the neighbor enumerator (the stored weight of a @ref weighted_enumerator or
+        /// node.distance_to(neighbor)), or @ref infinity if neighbor is not adjacent to node.
+        score_type edge_cost(const node_type& node, const node_type& neighbor) const
+        {
+            if (const auto* const cost = overridden_cost(node, neighbor))
+                return *cost;
+
+            score_type result = infinity;
+            const auto id = node_index_(neighbor);
+            auto enumerator = neighbor_enumerator_;
+            for (enumerator(node); enumerator; ++enumerator)
+                if (node_index_(*enumerator) == id)
+                    result = std::min(result, static_cast<score_type>(detail::edge_cost(enumerator, node, *enumerator)));
+
+            return result;
+        }
+
+        /// Gets the indexes of the nodes on the best path, from the start node to the target node. The path is empty
+        /// if there is no solution.
+        std::vector<index_type> path()
+        {
+            std::vector<index_type> result;
+            if (!has_solution())
+                return result;
+
+            node_type node = start_node_, next = start_node_;
+            const auto target = node_index_(target_node_);
+            for (result.push_back(static_cast<index_type>(node_index_(node))); result.back() != target; node = next)
+            {
+                score_type best_score = infinity;
+                for (neighbor_enumerator_(node); neighbor_enumerator_; ++neighbor_enumerator_)
+                {
+                    const node_type& neighbor = *neighbor_enumerator_;
+                    const auto score = add(enumerated_cost(node, neighbor), general_score(neighbor));
+                    if (score < best_score)
+                    {
+                        best_score = score;
+                        next = neighbor;
+                    }
+                }
+
+                if (best_score == infinity)
+                    return {};
+
+                result.push_back(static_cast<index_type>(node_index_(next)));
+            }
+
+            return result;
+        }
+
+    protected:
+        /// Priority of a queued node: first the estimated total score, then the general score.
+        struct priority
+        {
+            score_type total_score = infinity;
+            score_type general_score = infinity;
+
+            auto operator<=>(const priority&) const = default;
+        };
+
+        struct entry
+        {
+            index_type index;
+            priority key;
+
+            index_type id() const noexcept { return index; }
+            bool operator>(const entry& other) const noexcept { return key > other.key; }
+        };
+
+        struct record
+        {
+            node_type node;
+            score_type general_score = infinity;
+            score_type rhs = infinity;
+            bool visited {};
+        };
+
+        static score_type add(const score_type left, const score_type right) noexcept
+        {
+            return left == infinity || right == infinity ? infinity : left + right;
+        }
+
+        static std::uint64_t edge_key(const index_type from, const index_type to) noexcept { return std::uint64_t {from} << 32 | to; }
+
+        static score_type heuristic(node_type node, const node_type& target_node)
+        {
+            node.set_heuristic_score(score_type {}, target_node);
+            return node.heuristic_score();
+        }
+
+        const score_type* overridden_cost(const node_type& node, const node_type& neighbor) const
+        {
+            if (edge_costs_.empty())
+                return nullptr;
+
+            const auto found = edge_costs_.find(edge_key(static_cast<index_type>(node_index_(node)), static_cast<index_type>(node_index_(neighbor))));
+            return found != edge_costs_.end() ? &found->second : nullptr;
+        }
+
+        /// Gets the cost of the edge to the current neighbor of the enumerator, preferring the overridden cost.
+        score_type enumerated_cost(const node_type& node, const node_type& neighbor) const
+        {
+            const auto* const cost = overridden_cost(node, neighbor);
+            return cost ? *cost : detail::edge_cost(neighbor_enumerator_, node, neighbor);
+        }
+
+        bool is_pending() const noexcept
+        {
+            const auto start = node_index_(start_node_);
+            if (start >= records_.size())
+                return !queue_.empty();
+
+            // the record of a start node not reached yet holds no node to evaluate the heuristic on
+            const auto& item = records_[start];
+            if (!item.visited)
+                return !queue_.empty();
+
+            return !queue_.empty() && (queue_.top().key < key(item) || item.rhs != item.general_score);
+        }
+
+        priority key(const record& item) const
+        {
+            const auto score = std::min(item.general_score, item.rhs);
+            return {add(add(score, heuristic(item.node, start_node_)), key_modifier_), score};
+        }
+
+        priority key(const index_type index) const { return key(records_[index]); }
+
+        /// Gets the index of the node, recording it when it is seen for the first time.
+        index_type fetch(const node_type& node)
+        {
+            const auto index = static_cast<index_type>(node_index_(node));
+            if (index >= records_.size())
+                records_.resize(std::max<std::size_t>(std::size_t {index} + 1, records_.size() * 2));
+
+            auto& item = records_[index];
+            if (!item.visited)
+            {
+                item.node = node;
+                item.visited = true;
+            }
+
+            return index;
+        }
+
+        /// Recomputes the rhs of the node from its successors and queues it if it is inconsistent.
+        void update_node(const index_type index)
+        {
+            if (index != node_index_(target_node_))
+            {
+                const node_type node = records_[index].node;
+                score_type rhs = infinity;
+                for (neighbor_enumerator_(node); neighbor_enumerator_; ++neighbor_enumerator_)
+                {
+                    const node_type& neighbor = *neighbor_enumerator_;
+                    rhs = std::min(rhs, add(enumerated_cost(node, neighbor), general_score(neighbor)));
+                }
+
+                records_[index].rhs = rhs;
+            }
+
+            const auto& item = records_[index];
+            if (item.general_score != item.rhs)
+                queue_.push({index, key(item)});
+            else
+                queue_.erase({index, {}});
+        }
+
+        neighbor_enumerator_type neighbor_enumerator_;
+        reverse_neighbor_enumerator_type reverse_neighbor_enumerator_;
+        node_index_type node_index_;
+        node_type start_node_;
+        node_type last_start_node_;
+        node_type target_node_;
+        score_type key_modifier_ {};
+        quaternary_heap<entry> queue_;
+        std::pmr::vector<record> records_;
+        std::unordered_map<std::uint64_t, score_type> edge_costs_;
+        search_statistics statistics_;
+    };
+} // namespace stdext::astar
@@ -0,0 +1,178 @@
+/// A* Search Coroutines
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_algo.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <coroutine>
+    #include <cstddef>
+    #include <exception>
+    #include <iterator>
+    #include <memory>
+    #include <utility>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Lazy generator coroutine in the spirit of the C++23 std::generator: the coroutine starts suspended,
+    /// runs up to its next co_yield when the generator is advanced and yields references to its values. A generator
+    /// can be consumed with a range-for loop or step by step with @ref next, e.g. by a cooperative scheduler.
+    /// @note The yielded reference is valid until the generator is advanced. An exception escaping the coroutine is
+    /// rethrown by the call advancing the generator.
+    template <typename _Value>
+    class generator
+    {
+    public:
+        using value_type = _Value;
+        using reference = const value_type&;
+
+        class promise_type
+        {
+        public:
+            generator get_return_object() noexcept { return generator(handle_type::from_promise(*this)); }
+
+            std::suspend_always initial_suspend() const noexcept { return {}; }
+            std::suspend_always final_suspend() const noexcept { return {}; }
+
+            std::suspend_always yield_value(reference value) noexcept
+            {
+                value_ = std::addressof(value);
+                return {};
+            }
+
+            void return_void() const noexcept {}
+            void unhandled_exception() noexcept { exception_ = std::current_exception(); }
+
+            /// A generator yields, it does not await.
+            template <typename _Awaitable>
+            void await_transform(_Awaitable&&) = delete;
+
+        private:
+            friend generator;
+
+            const value_type* value_ {};
+            std::exception_ptr exception_;
+        };
+
+        using handle_type = std::coroutine_handle<promise_type>;
+
+        /// Input iterator advancing the generator.
+        class iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = _Value;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+
+            reference operator*() const noexcept { return *handle_.promise().value_; }
+            const value_type* operator->() const noexcept { return handle_.promise().value_; }
+
+            iterator& operator++()
+            {
+                generator::resume(handle_);
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            bool operator==(std::default_sentinel_t) const noexcept { return !handle_ || handle_.done(); }
+
+        private:
+            friend generator;
+
+            explicit iterator(const handle_type handle) noexcept: handle_(handle) {}
+
+            handle_type handle_;
+        };
+
+        generator() = default;
+        generator(generator&& other) noexcept: handle_(std::exchange(other.handle_, {})) {}
+
+        generator& operator=(generator&& other) noexcept
+        {
+            if (this != &other)
+            {
+                destroy();
+                handle_ = std::exchange(other.handle_, {});
+            }
+
+            return *this;
+        }
+
+        generator(const generator&) = delete;
+        generator& operator=(const generator&) = delete;
+
+        ~generator() { destroy(); }
+
+        /// Runs the coroutine up to the first value. A generator can be iterated only once.
+        iterator begin()
+        {
+            resume(handle_);
+            return iterator(handle_);
+        }
+
+        std::default_sentinel_t end() const noexcept { return {}; }
+
+        /// Runs the coroutine up to its next value.
+        /// @return Returns false if the coroutine ended, otherwise the new value is given by @ref value.
+        bool next()
+        {
+            resume(handle_);
+            return handle_ && !handle_.done();
+        }
+
+        /// Gets the last value yielded by the coroutine.
+        reference value() const noexcept { return *handle_.promise().value_; }
+
+        /// Checks if the coroutine ended.
+        bool done() const noexcept { return !handle_ || handle_.done(); }
+
+    private:
+        explicit generator(const handle_type handle) noexcept: handle_(handle) {}
+
+        static void resume(const handle_type handle)
+        {
+            if (!handle || handle.done())
+                return;
+
+            handle.resume();
+            if (handle.done() && handle.promise().exception_)
+                std::rethrow_exception(std::exchange(handle.promise().exception_, {}));
+        }
+
+        void destroy() noexcept
+        {
+            if (handle_)
+                handle_.destroy();
+
+            handle_ = {};
+        }
+
+        handle_type handle_;
+    };
+
+    /// Runs the search as a coroutine yielding the last expanded node (algo.node()) after every step_count
+    /// expansions and once more when the search ends, when has_solution() of the algorithm tells the outcome. Many
+    /// searches can be interleaved by advancing their generators in turn, without any other state machine.
+    /// @param[in] algo Algorithm (e.g. @ref algo or @ref anytime_algo); it has to outlive the generator
+    /// @param[in] step_count Number of expansions between two yields
+    template <typename _Algo>
+    generator<typename _Algo::node_type> expansions(_Algo& algo, const std::size_t step_count = 1)
+    {
+        const auto count = std::max<std::size_t>(step_count, 1);
+        for (bool can_continue = true; can_continue;)
+        {
+            if constexpr (requires { algo.run_steps(count); })
+                can_continue = algo.run_steps(count);
+            else
+                for (std::size_t i = 0; i != count && (can_continue = algo()); ++i)
+                {
+                }
+
+            co_yield algo.node();
+        }
+    }
+} // namespace stdext::astar
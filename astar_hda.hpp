@@ -0,0 +1,473 @@
+/// A* Hash-Distributed Parallel Search - HDA*
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_priority_queue.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <atomic>
+    #include <cstddef>
+    #include <cstdint>
+    #include <functional>
+    #include <limits>
+    #include <memory>
+    #include <mutex>
+    #include <optional>
+    #include <thread>
+    #include <unordered_map>
+    #include <utility>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Zobrist hashing of the states made of positions holding small values (e.g. the tiles of a sliding
+    /// puzzle or the pieces of a board): the hash of a state is the XOR of a random key per (position, value) pair,
+    /// so a move changing few positions updates the hash in O(1) (see @ref update).
+    class zobrist_table
+    {
+    public:
+        /// @param[in] position_count Number of positions
+        /// @param[in] value_count Number of values a position may hold, [0, value_count)
+        /// @param[in] seed Seed of the keys
+        zobrist_table(const std::size_t position_count, const std::size_t value_count, std::uint64_t seed = 0x9e3779b97f4a7c15):
+            keys_(position_count * value_count),
+            value_count_(value_count)
+        {
+            // splitmix64
+            for (auto& key: keys_)
+            {
+                std::uint64_t value = seed += 0x9e3779b97f4a7c15;
+                value = (value ^ (value >> 30)) * 0xbf58476d1ce4e5b9;
+                value = (value ^ (value >> 27)) * 0x94d049bb133111eb;
+                key = value ^ (value >> 31);
+            }
+        }
+
+        /// Gets the key of the value held by the position.
+        std::uint64_t operator()(const std::size_t position, const std::size_t value) const noexcept { return keys_[position * value_count_ + value]; }
+
+        /// Gets the hash of the state given by the values of all positions.
+        template <typename _Values>
+        std::uint64_t hash(const _Values& values) const noexcept
+        {
+            std::uint64_t result = 0;
+            std::size_t position = 0;
+            for (const auto value: values)
+                result ^= (*this)(position++, static_cast<std::size_t>(value));
+
+            return result;
+        }
+
+        /// Updates the hash after the value of the position changed.
+        std::uint64_t update(const std::uint64_t hash, const std::size_t position, const std::size_t old_value, const std::size_t new_value) const noexcept
+        {
+            return hash ^ (*this)(position, old_value) ^ (*this)(position, new_value);
+        }
+
+    private:
+        std::vector<std::uint64_t> keys_;
+        std::size_t value_count_;
+    };
+
+    namespace detail
+    {
+        /// @brief Lock-free multiple producer single consumer inbox of message batches: the producers push whole
+        /// batches (Treiber stack) and the consumer takes all of them at once, so it is free of the ABA problem.
+        template <typename _Message>
+        class batch_inbox
+        {
+        public:
+            struct batch
+            {
+                std::vector<_Message> messages;
+                batch* next {};
+            };
+
+            batch_inbox() = default;
+            batch_inbox(const batch_inbox&) = delete;
+            batch_inbox& operator=(const batch_inbox&) = delete;
+
+            ~batch_inbox()
+            {
+                for (auto* item = head_.load(std::memory_order_relaxed); item;)
+                    delete std::exchange(item, item->next);
+            }
+
+            bool empty() const noexcept { return head_.load(std::memory_order_relaxed) == nullptr; }
+
+            /// Pushes a batch, taking its ownership (producers).
+            void push(std::unique_ptr<batch> item) noexcept
+            {
+                auto* const raw = item.release();
+                raw->next = head_.load(std::memory_order_relaxed);
+                while (!head_.compare_exchange_weak(raw->next, raw, std::memory_order_release, std::memory_order_relaxed))
+                {
+                }
+            }
+
+            /// Takes all the batches, newest first (consumer); they have to be freed with delete.
+            batch* take_all() noexcept { return head_.exchange(nullptr, std::memory_order_acquire); }
+
+        private:
+            std::atomic<batch*> head_ {};
+        };
+    } // namespace detail
+
+    /// @brief Hash Distributed A* (HDA*) - a single search run by several threads. The state space is partitioned
+    /// by the hash of the nodes: each thread owns the nodes hashed to it, keeps their open set (the _PriorityQueue
+    /// policy with lazy deletion, like @ref algo) and their closed set, and sends the generated nodes it does not
+    /// own to their owners in batches, through lock-free inboxes. The first path found sets an incumbent cost which
+    /// prunes the nodes having a total score not lower than it; the search ends when all the threads are idle and
+    /// no batch is in flight, which is tracked by a single atomic counter, and the incumbent is then optimal for an
+    /// admissible heuristic.
+    /// @note Meant for huge implicit state spaces (e.g. puzzles) with nodes hashed by _Hash, e.g. a Zobrist hash (see
+    /// @ref zobrist_table). Each thread works on its own copy of the neighbor enumerator, and the heuristic
+    /// (set_heuristic_score(general_score, target_node)) is called concurrently, so both have to be thread safe.
+    /// @note The score type has to be lock-free atomic (e.g. int or float).
+    template <typename _Node, typename _NeighborEnumerator, typename _SolutionVerifier, typename _Hash = std::hash<_Node>,
+              typename _KeyEqual = std::equal_to<_Node>, typename _PriorityQueue = default_priority_queue<_Node>>
+    class hda_algo
+    {
+    public:
+        using node_type = _Node;
+        using score_type = typename node_type::score_type;
+        using neighbor_enumerator_type = _NeighborEnumerator;
+        using solution_verifier_type = _SolutionVerifier;
+        using hash_type = _Hash;
+        using key_equal_type = _KeyEqual;
+        using priority_queue_type = _PriorityQueue;
+
+        static_assert(neighbor_enumerator<neighbor_enumerator_type, node_type>);
+
+        static constexpr std::size_t default_batch_size = 64;
+
+        /// @param[in] start_node Start node
+        /// @param[in] target_node Target node, used by the heuristic
+        /// @param[in] solution_verifier Verifier recognizing the target nodes
+        /// @param[in] neighbor_enumerator Enumerator of adjacent nodes, copied for each thread
+        /// @param[in] thread_count Number of threads; 0 uses one per hardware thread
+        /// @param[in] batch_size Number of nodes sent to another thread at once
+        hda_algo(node_type start_node, node_type target_node, solution_verifier_type solution_verifier,
+                 const neighbor_enumerator_type& neighbor_enumerator, const std::size_t thread_count = 0,
+                 const std::size_t batch_size = default_batch_size, hash_type hash = {}, key_equal_type key_equal = {}):
+            start_node_(std::move(start_node)),
+            target_node_(std::move(target_node)),
+            solution_verifier_(std::move(solution_verifier)),
+            hash_(std::move(hash)),
+            batch_size_(std::max<std::size_t>(batch_size, 1))
+        {
+            const auto count = thread_count != 0 ? thread_count : std::max<std::size_t>(std::thread::hardware_concurrency(), 1);
+            workers_.reserve(count);
+            for (std::size_t i = 0; i != count; ++i)
+                workers_.push_back(std::make_unique<worker>(neighbor_enumerator, count, hash_, key_equal));
+        }
+
+        /// Gets the number of threads.
+        std::size_t thread_count() const noexcept { return workers_.size(); }
+
+        /// Runs the whole search on the threads.
+        /// @return Returns @ref has_solution.
+        bool operator()()
+        {
+            incumbent_.store(std::numeric_limits<score_type>::max());
+            goal_.reset();
+            start_node_.set_general_score(score_type {});
+            const auto owner = owner_of(start_node_);
+            // the owner of the start node is active from the beginning, the others wait for nodes
+            counter_.store(workers_.size());
+            std::vector<std::jthread> threads;
+            threads.reserve(workers_.size());
+            for (std::size_t i = 0; i != workers_.size(); ++i)
+                threads.emplace_back([this, i, owner] { run(i, i == owner); });
+
+            threads.clear();
+            return has_solution();
+        }
+
+        bool has_solution() const noexcept { return goal_.has_value(); }
+
+        /// Gets the cost of the best path.
+        score_type cost() const noexcept { return incumbent_.load(); }
+
+        /// Gets the nodes of the best path, from the start node to the target node.
+        std::vector<node_type> path() const
+        {
+            std::vector<node_type> result;
+            if (!goal_)
+                return result;
+
+            for (const node_type* node = &*goal_; node;)
+            {
+                result.push_back(*node);
+                const auto& records = workers_[owner_of(*node)]->records;
+                const auto found = records.find(*node);
+                node = found != records.end() && found->second.parent ? &*found->second.parent : nullptr;
+            }
+
+            std::reverse(result.begin(), result.end());
+            return result;
+        }
+
+        /// Gets the search counters, summed over the threads.
+        search_statistics statistics() const noexcept
+        {
+            search_statistics result;
+            for (const auto& item: workers_)
+            {
+                result.expanded_nodes += item->statistics.expanded_nodes;
+                result.dropped_closed_entries += item->statistics.dropped_closed_entries;
+                result.dropped_superseded_entries += item->statistics.dropped_superseded_entries;
+            }
+
+            return result;
+        }
+
+    private:
+        /// Generated node sent to its owner.
+        struct message
+        {
+            node_type node;
+            node_type parent;
+        };
+
+        struct record
+        {
+            score_type general_score;
+            std::optional<node_type> parent {};
+            bool closed {};
+        };
+
+        using inbox_type = detail::batch_inbox<message>;
+        using batch_type = typename inbox_type::batch;
+
+        struct alignas(64) worker
+        {
+            worker(const neighbor_enumerator_type& neighbor_enumerator, const std::size_t count, const hash_type& hash, const key_equal_type& key_equal):
+                enumerator(neighbor_enumerator),
+                records(0, hash, key_equal),
+                outgoing(count)
+            {
+            }
+
+            inbox_type inbox;
+            neighbor_enumerator_type enumerator;
+            priority_queue_type open;
+            std::unordered_map<node_type, record, hash_type, key_equal_type> records;
+            std::vector<std::unique_ptr<batch_type>> outgoing;
+            search_statistics statistics;
+            /// Bumped after a batch is pushed to the inbox or when the search ends; an idle thread sleeps on it.
+            std::atomic<std::uint32_t> signal {};
+        };
+
+        /// The counter holds the number of active threads in the low half and the number of batches in flight in
+        /// the high half, so a thread waking up on a batch updates both in one step and the search ends exactly
+        /// when the counter drops to 0.
+        static constexpr std::uint64_t batch_unit = std::uint64_t {1} << 32;
+
+        std::size_t owner_of(const node_type& node) const
+        {
+            // the high bits of a multiplicative mix, since the hash may be the identity
+            const auto mixed = static_cast<std::uint64_t>(hash_(node)) * 0x9e3779b97f4a7c15;
+            return static_cast<std::size_t>((mixed >> 32) * workers_.size() >> 32);
+        }
+
+        void run(const std::size_t index, const bool owns_start)
+        {
+            auto& self = *workers_[index];
+            self.records.clear();
+            self.statistics = {};
+            while (!self.open.empty())
+                self.open.pop();
+
+            if (owns_start)
+                insert(self, start_node_, nullptr);
+
+            std::size_t expansions = 0;
+            for (;;)
+            {
+                receive(self, true);
+                if (expand(self))
+                {
+                    // the partial batches are sent regularly, so the other threads do not starve
+                    if (++expansions % batch_size_ == 0)
+                        flush(self);
+
+                    continue;
+                }
+
+                flush(self);
+                if (!self.inbox.empty())
+                    continue;
+
+                if (counter_.fetch_sub(1) == 1)
+                {
+                    // the last active thread with no batch in flight ends the search
+                    for (const auto& item: workers_)
+                        wake(*item);
+
+                    return;
+                }
+
+                for (;;)
+                {
+                    // the signal is read before the checks, so a batch pushed after them changes it and the wait
+                    // does not block
+                    const auto signal = self.signal.load();
+                    if (!self.inbox.empty())
+                    {
+                        receive(self, false);
+                        break;
+                    }
+
+                    if (counter_.load() == 0)
+                        return;
+
+                    self.signal.wait(signal);
+                }
+            }
+        }
+
+        /// Processes the received batches. An idle thread becomes active in the same counter update.
+        void receive(worker& self, const bool active)
+        {
+            auto* item = self.inbox.take_all();
+            if (!item && active)
+                return;
+
+            std::uint64_t batches = 0;
+            for (auto* current = item; current; current = current->next)
+                ++batches;
+
+            counter_.fetch_sub(batches * batch_unit - (active ? 0 : 1));
+            while (item)
+            {
+                std::unique_ptr<batch_type> current(std::exchange(item, item->next));
+                for (auto& received: current->messages)
+                    insert(self, std::move(received.node), &received.parent);
+            }
+        }
+
+        /// Records an owned node if it improves its best known general score and queues it unless it is pruned.
+        void insert(worker& self, node_type node, const node_type* const parent)
+        {
+            const auto general_score = node.general_score();
+            const auto [found, inserted] = self.records.try_emplace(node, record {general_score});
+            if (!inserted)
+            {
+                if (!(general_score < found->second.general_score))
+                    return;
+
+                found->second.general_score = general_score;
+                found->second.closed = false;
+            }
+
+            if (parent)
+                found->second.parent = *parent;
+
+            node.set_heuristic_score(general_score, target_node_);
+            if (node.total_score() < incumbent_.load(std::memory_order_relaxed))
+                self.open.push(std::move(node));
+        }
+
+        /// Expands the best open node unless the open set is empty or pruned by the incumbent.
+        /// @return Returns true if a node was taken from the open set.
+        bool expand(worker& self)
+        {
+            while (!self.open.empty())
+            {
+                const auto& top = self.open.top();
+                auto& item = self.records.find(top)->second;
+                if (item.closed || item.general_score < top.general_score())
+                {
+                    ++(item.closed ? self.statistics.dropped_closed_entries : self.statistics.dropped_superseded_entries);
+                    self.open.pop();
+                    continue;
+                }
+
+                if (!(top.total_score() < incumbent_.load(std::memory_order_relaxed)))
+                    return false;
+
+                const node_type node = top;
+                self.open.pop();
+                item.closed = true;
+                if (solution_verifier_(node))
+                {
+                    update_incumbent(node);
+                    return true;
+                }
+
+                ++self.statistics.expanded_nodes;
+                auto& enumerator = self.enumerator;
+                for (enumerator(node); enumerator; ++enumerator)
+                {
+                    node_type neighbor = *enumerator;
+                    neighbor.set_general_score(node.general_score() + detail::edge_cost(enumerator, node, neighbor));
+                    const auto owner = owner_of(neighbor);
+                    if (&self == workers_[owner].get())
+                    {
+                        insert(self, std::move(neighbor), &node);
+                        continue;
+                    }
+
+                    auto& batch = self.outgoing[owner];
+                    if (!batch)
+                    {
+                        batch = std::make_unique<batch_type>();
+                        batch->messages.reserve(batch_size_);
+                    }
+
+                    batch->messages.push_back({std::move(neighbor), node});
+                    if (batch->messages.size() == batch_size_)
+                        send(owner, batch);
+                }
+
+                return true;
+            }
+
+            return false;
+        }
+
+        void send(const std::size_t owner, std::unique_ptr<batch_type>& batch)
+        {
+            counter_.fetch_add(batch_unit);
+            auto& target = *workers_[owner];
+            target.inbox.push(std::move(batch));
+            wake(target);
+        }
+
+        static void wake(worker& target) noexcept
+        {
+            target.signal.fetch_add(1);
+            target.signal.notify_one();
+        }
+
+        void flush(worker& self)
+        {
+            for (std::size_t owner = 0; owner != self.outgoing.size(); ++owner)
+                if (self.outgoing[owner] && !self.outgoing[owner]->messages.empty())
+                    send(owner, self.outgoing[owner]);
+        }
+
+        void update_incumbent(const node_type& goal)
+        {
+            std::lock_guard lock(goal_mutex_);
+            if (goal.general_score() < incumbent_.load())
+            {
+                incumbent_.store(goal.general_score());
+                goal_ = goal;
+            }
+        }
+
+        node_type start_node_;
+        node_type target_node_;
+        solution_verifier_type solution_verifier_;
+        hash_type hash_;
+        std::size_t batch_size_;
+        std::vector<std::unique_ptr<worker>> workers_;
+        std::atomic<std::uint64_t> counter_ {};
+        std::atomic<score_type> incumbent_ {};
+        std::mutex goal_mutex_;
+        std::optional<node_type> goal_;
+    };
+} // namespace stdext::astar
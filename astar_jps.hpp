@@ -0,0 +1,343 @@
+/// A* Jump Point Search
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_node_table.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <array>
+    #include <cstdint>
+    #include <cstdlib>
+    #include <iterator>
+    #include <string_view>
+    #include <type_traits>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// Uniform-cost 8-connected grid map. The cells are addressed by (x, y) and have the dense index y * width + x.
+    class grid_map
+    {
+    public:
+        grid_map(const int width, const int height): width_(width), height_(height), walkable_(std::size_t(width) * height, 1) {}
+
+        /// Creates the map from text rows, where '#' marks a blocked cell.
+        template <typename _Rows>
+        explicit grid_map(const _Rows& rows): grid_map(static_cast<int>(std::string_view(*std::begin(rows)).size()), static_cast<int>(std::size(rows)))
+        {
+            int y = 0;
+            for (const std::string_view row: rows)
+            {
+                for (int x = 0; x != width_; ++x)
+                    set_walkable(x, y, row[x] != '#');
+
+                ++y;
+            }
+        }
+
+        int width() const noexcept { return width_; }
+        int height() const noexcept { return height_; }
+        std::size_t size() const noexcept { return walkable_.size(); }
+
+        int index(const int x, const int y) const noexcept { return y * width_ + x; }
+
+        /// Checks if the cell is inside the map and not blocked.
+        bool walkable(const int x, const int y) const noexcept
+        {
+            return x >= 0 && y >= 0 && x < width_ && y < height_ && walkable_[index(x, y)];
+        }
+
+        void set_walkable(const int x, const int y, const bool value) noexcept { walkable_[index(x, y)] = value; }
+
+    private:
+        int width_, height_;
+        std::vector<std::uint8_t> walkable_;
+    };
+
+    /// @brief Grid node of @ref jps_enumerator - a cell reached with the given travel direction (the sign of the
+    /// move from its parent jump point). The moves cost 1 (straight) and sqrt(2) (diagonal); the integral scores are
+    /// scaled to 1000 and 1414. The heuristic is the octile distance.
+    template <typename _Score = int>
+    class grid_node: public base_node<_Score>
+    {
+    public:
+        using score_type = _Score;
+        using base_type = base_node<score_type>;
+
+        static constexpr score_type straight_cost = std::is_floating_point_v<score_type> ? score_type(1) : score_type(1000);
+        static constexpr score_type diagonal_cost = std::is_floating_point_v<score_type> ? score_type(1.4142135623730951) : score_type(1414);
+
+        grid_node(const int id = 0, const int x = 0, const int y = 0, const int dx = 0, const int dy = 0) noexcept:
+            id_(id), x_(x), y_(y), dx_(static_cast<std::int8_t>(dx)), dy_(static_cast<std::int8_t>(dy))
+        {
+        }
+
+        operator int() const noexcept { return id_; }
+
+        int id() const noexcept { return id_; }
+        int x() const noexcept { return x_; }
+        int y() const noexcept { return y_; }
+
+        /// Gets the travel direction - the sign of the move from the parent, or 0 for the start node.
+        int dx() const noexcept { return dx_; }
+        int dy() const noexcept { return dy_; }
+
+        /// Gets the octile distance, which is the cost of a straight or diagonal jump.
+        score_type distance_to(const grid_node& node) const noexcept { return octile(std::abs(node.x_ - x_), std::abs(node.y_ - y_)); }
+
+        void set_heuristic_score(score_type, const grid_node& target_node) noexcept { base_type::set_heuristic_score(distance_to(target_node)); }
+
+        static score_type octile(const int dx, const int dy) noexcept
+        {
+            const auto [low, high] = std::minmax(dx, dy);
+            return diagonal_cost * low + straight_cost * (high - low);
+        }
+
+    protected:
+        int id_, x_, y_;
+        std::int8_t dx_, dy_;
+    };
+
+    /// @brief JPS+ jump distances - for each cell and cardinal direction (east, west, south, north) the distance to the
+    /// next straight jump point (positive) or the negated number of walkable cells before a wall (zero or negative).
+    /// The straight jumps of @ref jps_enumerator become a table lookup. The table has to be rebuilt when the map
+    /// changes.
+    class jump_table
+    {
+    public:
+        static constexpr int directions[4][2] = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}};
+
+        explicit jump_table(const grid_map& map): distances_(map.size() * 4)
+        {
+            for (int direction = 0; direction != 4; ++direction)
+            {
+                const auto [dx, dy] = directions[direction];
+                // visits the cells so that the next cell in the direction is computed first
+                for (int row = 0; row != map.height(); ++row)
+                    for (int column = 0; column != map.width(); ++column)
+                    {
+                        const int x = dx > 0 ? map.width() - 1 - column : column;
+                        const int y = dy > 0 ? map.height() - 1 - row : row;
+                        const int next_x = x + dx, next_y = y + dy;
+                        int distance = 0;
+                        if (map.walkable(next_x, next_y))
+                        {
+                            if (is_forced(map, next_x, next_y, dx, dy))
+                                distance = 1;
+                            else
+                            {
+                                const int next = distances_[slot(map.index(next_x, next_y), direction)];
+                                distance = next > 0 ? next + 1 : next - 1;
+                            }
+                        }
+
+                        distances_[slot(map.index(x, y), direction)] = distance;
+                    }
+            }
+        }
+
+        /// Gets the jump distance of the cell in the given direction index (see @ref directions).
+        int distance(const int index, const int direction) const noexcept { return distances_[slot(index, direction)]; }
+
+        /// Gets the direction index of a straight move.
+        static int direction(const int dx, const int dy) noexcept { return dx > 0 ? 0 : dx < 0 ? 1 : dy > 0 ? 2 : 3; }
+
+        /// Checks if a straight move reaching the cell has a forced neighbor there (no corner cutting rules).
+        static bool is_forced(const grid_map& map, const int x, const int y, const int dx, const int dy) noexcept
+        {
+            if (dx != 0)
+                return (map.walkable(x, y - 1) && !map.walkable(x - dx, y - 1)) || (map.walkable(x, y + 1) && !map.walkable(x - dx, y + 1));
+
+            return (map.walkable(x - 1, y) && !map.walkable(x - 1, y - dy)) || (map.walkable(x + 1, y) && !map.walkable(x + 1, y - dy));
+        }
+
+    private:
+        static std::size_t slot(const int index, const int direction) noexcept { return std::size_t(index) * 4 + direction; }
+
+        std::vector<int> distances_;
+    };
+
+    /// @brief Jump Point Search neighbor enumerator for uniform-cost 8-connected grids where the diagonal moves
+    /// may not cut corners (both adjacent straight cells have to be walkable). The enumerated nodes are the jump
+    /// points reachable from the node along its pruned directions, so only the jump points enter the open set.
+    /// @note The straight jumps use the @ref jump_table when one is given (JPS+), otherwise they scan the map.
+    /// @note The returned path consists of jump points; @ref expand_jump_path restores the cells between them.
+    template <typename _Node = grid_node<>>
+    class jps_enumerator
+    {
+    public:
+        using node_type = _Node;
+
+        jps_enumerator(const grid_map& map, const node_type& target_node, const jump_table* const table = nullptr) noexcept:
+            map_(&map),
+            table_(table),
+            target_x_(target_node.x()),
+            target_y_(target_node.y())
+        {
+        }
+
+        operator bool() const noexcept { return position_ < count_; }
+
+        void operator()(const node_type& node)
+        {
+            count_ = 0;
+            position_ = 0;
+            const int x = node.x(), y = node.y(), dx = node.dx(), dy = node.dy();
+            if (dx == 0 && dy == 0)
+            {
+                for (int ndy = -1; ndy <= 1; ++ndy)
+                    for (int ndx = -1; ndx <= 1; ++ndx)
+                        if ((ndx != 0 || ndy != 0) && can_move(x, y, ndx, ndy))
+                            jump(x, y, ndx, ndy);
+            }
+            else if (dx != 0 && dy != 0)
+            {
+                jump(x, y, 0, dy);
+                jump(x, y, dx, 0);
+                if (can_move(x, y, dx, dy))
+                    jump(x, y, dx, dy);
+            }
+            else
+            {
+                // straight move: the natural neighbor and the neighbors forced by the walls behind the node
+                const int px = dy, py = dx;
+                jump(x, y, dx, dy);
+                for (const int side: {1, -1})
+                    if (map_->walkable(x + side * px, y + side * py))
+                    {
+                        jump(x, y, side * px, side * py);
+                        if (can_move(x, y, dx + side * px, dy + side * py))
+                            jump(x, y, dx + side * px, dy + side * py);
+                    }
+            }
+        }
+
+        void operator++() noexcept { ++position_; }
+
+        node_type& operator*() noexcept { return successors_[position_]; }
+
+        void set_target(const node_type& target_node) noexcept
+        {
+            target_x_ = target_node.x();
+            target_y_ = target_node.y();
+        }
+
+    protected:
+        bool can_move(const int x, const int y, const int dx, const int dy) const noexcept
+        {
+            if (!map_->walkable(x + dx, y + dy))
+                return false;
+
+            return dx == 0 || dy == 0 || (map_->walkable(x + dx, y) && map_->walkable(x, y + dy));
+        }
+
+        bool is_target(const int x, const int y) const noexcept { return x == target_x_ && y == target_y_; }
+
+        /// Jumps from the cell in the given direction and records the found jump point.
+        void jump(const int x, const int y, const int dx, const int dy)
+        {
+            int jx = x, jy = y;
+            const bool found = dx != 0 && dy != 0 ? jump_diagonal(jx, jy, dx, dy) : jump_straight(jx, jy, dx, dy);
+            if (found)
+                successors_[count_++] = node_type(map_->index(jx, jy), jx, jy, dx, dy);
+        }
+
+        /// Moves (x, y) to the next straight jump point. Returns false if a wall comes first.
+        bool jump_straight(int& x, int& y, const int dx, const int dy) const noexcept
+        {
+            if (table_)
+            {
+                const int distance = table_->distance(map_->index(x, y), jump_table::direction(dx, dy));
+                const int reach = std::abs(distance);
+                const int to_target = dx != 0 ? (target_x_ - x) * dx : (target_y_ - y) * dy;
+                const bool aligned = dx != 0 ? target_y_ == y : target_x_ == x;
+                if (aligned && to_target > 0 && to_target <= reach)
+                {
+                    x = target_x_;
+                    y = target_y_;
+                    return true;
+                }
+
+                if (distance <= 0)
+                    return false;
+
+                x += distance * dx;
+                y += distance * dy;
+                return true;
+            }
+
+            for (;;)
+            {
+                x += dx;
+                y += dy;
+                if (!map_->walkable(x, y))
+                    return false;
+
+                if (is_target(x, y) || jump_table::is_forced(*map_, x, y, dx, dy))
+                    return true;
+            }
+        }
+
+        /// Moves (x, y) to the next diagonal jump point - a cell having a straight jump point ahead.
+        bool jump_diagonal(int& x, int& y, const int dx, const int dy) const noexcept
+        {
+            for (;;)
+            {
+                x += dx;
+                y += dy;
+                if (!map_->walkable(x, y))
+                    return false;
+
+                if (is_target(x, y))
+                    return true;
+
+                int sx = x, sy = y;
+                if (jump_straight(sx, sy, dx, 0))
+                    return true;
+
+                sx = x;
+                sy = y;
+                if (jump_straight(sx, sy, 0, dy))
+                    return true;
+
+                if (!can_move(x, y, dx, dy))
+                    return false;
+            }
+        }
+
+        const grid_map* map_;
+        const jump_table* table_;
+        int target_x_, target_y_;
+        std::array<node_type, 8> successors_;
+        unsigned count_ {}, position_ {};
+    };
+
+    /// Restores the cells between the consecutive jump points of a path (e.g. dense_node_table::path).
+    template <typename _Index>
+    std::vector<_Index> expand_jump_path(const grid_map& map, const std::vector<_Index>& jump_points)
+    {
+        std::vector<_Index> result;
+        for (std::size_t i = 0; i != jump_points.size(); ++i)
+        {
+            const int x = static_cast<int>(jump_points[i]) % map.width(), y = static_cast<int>(jump_points[i]) / map.width();
+            if (i != 0)
+            {
+                const int from_x = static_cast<int>(result.back()) % map.width(), from_y = static_cast<int>(result.back()) / map.width();
+                const int dx = (x > from_x) - (x < from_x), dy = (y > from_y) - (y < from_y);
+                for (int cx = from_x + dx, cy = from_y + dy; cx != x || cy != y; cx += dx, cy += dy)
+                    result.push_back(static_cast<_Index>(map.index(cx, cy)));
+            }
+
+            result.push_back(jump_points[i]);
+        }
+
+        return result;
+    }
+
+    /// A* algorithm using Jump Point Search on a @ref grid_map, with a @ref dense_node_table as open set, closed set
+    /// and solution map.
+    template <typename _Score = int, typename _Table = dense_node_table<_Score>>
+    using jps_algo = algo<grid_node<_Score>, dense_heap<grid_node<_Score>, _Table>, jps_enumerator<grid_node<_Score>>, _Table,
+                          target_id_verifier, _Table>;
+} // namespace stdext::astar
@@ -0,0 +1,370 @@
+/// A* Landmark (ALT) Heuristic
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_csr_graph.hpp"
+#include "astar_simd.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <cmath>
+    #include <cstdint>
+    #include <functional>
+    #include <limits>
+    #include <memory_resource>
+    #include <optional>
+    #include <queue>
+    #include <span>
+    #include <type_traits>
+    #include <utility>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// Landmark selection method of a @ref landmark_table.
+    enum class landmark_selection : std::uint8_t
+    {
+        /// Each landmark is the node farthest from the already selected landmarks.
+        farthest,
+        /// Each landmark is the leaf of the shortest path tree subtree which is the worst covered by the already
+        /// selected landmarks (Goldberg and Harrelson "avoid" method).
+        avoid
+    };
+
+    namespace detail
+    {
+        /// One-to-all Dijkstra search on a CSR graph. The unreachable nodes get the maximal weight value.
+        /// @param[out] parents Optional parent of each node in the shortest path tree
+        /// @param[out] order Optional order in which the nodes were settled
+        template <typename _Weight, typename _Index>
+        void shortest_distances(const csr_view<_Weight, _Index>& graph, const _Index source, std::vector<_Weight>& distances,
+                                std::vector<_Index>* const parents = nullptr, std::vector<_Index>* const order = nullptr)
+        {
+            constexpr auto infinity = std::numeric_limits<_Weight>::max();
+            using entry = std::pair<_Weight, _Index>;
+            distances.assign(graph.node_count(), infinity);
+            if (parents)
+                parents->assign(graph.node_count(), ~_Index {});
+
+            if (order)
+                order->clear();
+
+            std::priority_queue<entry, std::vector<entry>, std::greater<entry>> queue;
+            distances[source] = {};
+            queue.push({_Weight {}, source});
+            while (!queue.empty())
+            {
+                const auto [distance, node] = queue.top();
+                queue.pop();
+                if (distance > distances[node])
+                    continue;
+
+                if (order)
+                    order->push_back(node);
+
+                const auto targets = graph.targets(node);
+                const auto weights = graph.weights(node);
+                for (std::size_t i = 0; i != targets.size(); ++i)
+                {
+                    const auto tentative = distance + weights[i];
+                    if (tentative < distances[targets[i]])
+                    {
+                        distances[targets[i]] = tentative;
+                        if (parents)
+                            (*parents)[targets[i]] = node;
+
+                        queue.push({tentative, targets[i]});
+                    }
+                }
+            }
+        }
+    } // namespace detail
+
+    /// @brief ALT (A*, Landmarks, Triangle inequality) preprocessing: the shortest distances between K selected
+    /// landmarks and all the nodes of a @ref csr_view graph. By the triangle inequality
+    /// d(v, t) >= max(d(L, t) - d(L, v), d(v, L) - d(t, L)) for every landmark L, which gives a consistent heuristic
+    /// much tighter than the geometric distances on road-like graphs.
+    /// @note The distances are stored per node, the K (or 2K on directed graphs) distances of a node being contiguous.
+    /// Each group of K distances is padded with zeros to a multiple of the step of the SIMD kernels (8 distances, see
+    /// detail::landmark_lanes), so the bound is computed by the kernels of astar_simd.hpp when the processor supports
+    /// them.
+    /// @note An integral _Distance quantizes the distances. When the graph weights are integral and the largest
+    /// distance fits, the quantization is exact; otherwise the distances are scaled by @ref unit and the bound is
+    /// lowered by one unit, which keeps it admissible but not necessarily consistent. A floating point _Distance keeps
+    /// the distances as they are.
+    template <typename _Weight = float, typename _Index = std::uint32_t, typename _Distance = std::uint16_t>
+    class landmark_table
+    {
+    public:
+        using weight_type = _Weight;
+        using index_type = _Index;
+        using distance_type = _Distance;
+        using view_type = csr_view<weight_type, index_type>;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        static constexpr distance_type infinity = std::numeric_limits<distance_type>::max();
+
+        /// Preprocesses a symmetric graph (every edge has a reverse edge of the same weight).
+        /// @param[in] graph Graph
+        /// @param[in] landmark_count Number of landmarks (K)
+        /// @param[in] selection Landmark selection method
+        landmark_table(const view_type& graph, const std::size_t landmark_count, const landmark_selection selection = landmark_selection::avoid,
+                       const allocator_type& allocator = {}):
+            landmarks_(allocator),
+            distances_(allocator)
+        {
+            build(graph, nullptr, landmark_count, selection);
+        }
+
+        /// Preprocesses a directed graph, storing the distances from and to the landmarks.
+        /// @param[in] reverse Reverse graph (see @ref make_reverse_graph)
+        /// @see The other parameters are described by the constructor above.
+        landmark_table(const view_type& graph, const view_type& reverse, const std::size_t landmark_count,
+                       const landmark_selection selection = landmark_selection::avoid, const allocator_type& allocator = {}):
+            landmarks_(allocator),
+            distances_(allocator)
+        {
+            build(graph, &reverse, landmark_count, selection);
+        }
+
+        std::size_t landmark_count() const noexcept { return landmarks_.size(); }
+        std::span<const index_type> landmarks() const noexcept { return landmarks_; }
+
+        /// Checks if the table keeps also the distances to the landmarks.
+        bool directed() const noexcept { return stride_ != padded_count_; }
+
+        /// Gets the number of distances of a group (from or to the landmarks) including the padding.
+        std::size_t padded_count() const noexcept { return padded_count_; }
+
+        /// Gets the number of distances of a node.
+        std::size_t stride() const noexcept { return stride_; }
+
+        /// Gets the graph distance of a quantization step.
+        double unit() const noexcept { return unit_; }
+
+        /// Checks if the stored distances are exact.
+        bool exact() const noexcept { return exact_; }
+
+        /// Gets the distances of the node: from the landmarks, followed by the distances to them on directed graphs,
+        /// each group padded to @ref padded_count.
+        std::span<const distance_type> distances(const index_type node) const noexcept
+        {
+            return {distances_.data() + std::size_t(node) * stride_, stride_};
+        }
+
+        /// Gets the lower bound of the distance from node to target.
+        weight_type heuristic(const index_type node, const index_type target) const noexcept
+        {
+            const std::size_t count = padded_count_;
+            const auto bound = detail::landmark_bound(distances_.data() + std::size_t(target) * stride_,
+                                                      distances_.data() + std::size_t(node) * stride_, count, directed() ? count : 0, count);
+            return score(bound);
+        }
+
+        /// Converts a bound in stored distance units to a graph distance.
+        template <typename _Bound>
+        weight_type score(const _Bound bound) const noexcept
+        {
+            if (exact_)
+                return static_cast<weight_type>(bound);
+
+            return bound > 1 ? static_cast<weight_type>((static_cast<double>(bound) - 1) * unit_) : weight_type {};
+        }
+
+    private:
+        void build(const view_type& graph, const view_type* const reverse, std::size_t landmark_count, const landmark_selection selection)
+        {
+            const std::size_t node_count = graph.node_count();
+            landmark_count = std::min(landmark_count, node_count);
+            std::vector<std::vector<weight_type>> from, to;
+            select(graph, reverse, landmark_count, selection, from, to);
+
+            weight_type largest {};
+            for (const auto* rows: {&from, &to})
+                for (const auto& row: *rows)
+                    for (const auto distance: row)
+                        if (distance != std::numeric_limits<weight_type>::max())
+                            largest = std::max(largest, distance);
+
+            if constexpr (std::is_floating_point_v<distance_type>)
+                exact_ = true;
+            else
+                exact_ = std::is_integral_v<weight_type> && static_cast<std::uint64_t>(largest) < std::uint64_t {infinity};
+
+            unit_ = exact_ ? 1.0 : std::max(static_cast<double>(largest) / (double(infinity) - 1), std::numeric_limits<double>::min());
+            constexpr auto lanes = detail::landmark_lanes<distance_type>;
+            padded_count_ = (landmarks_.size() + lanes - 1) / lanes * lanes;
+            stride_ = reverse ? 2 * padded_count_ : padded_count_;
+            distances_.assign(node_count * stride_, distance_type {});
+            for (std::size_t node = 0; node != node_count; ++node)
+            {
+                auto* const row = distances_.data() + node * stride_;
+                for (std::size_t i = 0; i != landmarks_.size(); ++i)
+                {
+                    row[i] = quantize(from[i][node]);
+                    if (reverse)
+                        row[padded_count_ + i] = quantize(to[i][node]);
+                }
+            }
+        }
+
+        distance_type quantize(const weight_type distance) const noexcept
+        {
+            if (distance == std::numeric_limits<weight_type>::max())
+                return infinity;
+
+            if (exact_)
+                return static_cast<distance_type>(distance);
+
+            return static_cast<distance_type>(std::min(std::floor(static_cast<double>(distance) / unit_), double(infinity) - 1));
+        }
+
+        /// Selects the landmarks, computing their full precision distance rows.
+        void select(const view_type& graph, const view_type* const reverse, const std::size_t landmark_count, const landmark_selection selection,
+                    std::vector<std::vector<weight_type>>& from, std::vector<std::vector<weight_type>>& to)
+        {
+            constexpr auto infinity_weight = std::numeric_limits<weight_type>::max();
+            const std::size_t node_count = graph.node_count();
+            std::vector<weight_type> coverage(node_count, infinity_weight), distances;
+            std::vector<index_type> parents, order;
+            std::uint32_t seed = 0x9e3779b9u;
+            const auto add_landmark = [&](const index_type landmark) {
+                landmarks_.push_back(landmark);
+                from.emplace_back();
+                detail::shortest_distances(graph, landmark, from.back());
+                if (reverse)
+                {
+                    to.emplace_back();
+                    detail::shortest_distances(*reverse, landmark, to.back());
+                }
+
+                for (std::size_t node = 0; node != node_count; ++node)
+                    coverage[node] = std::min(coverage[node], from.back()[node]);
+            };
+            const auto farthest = [&](const std::vector<weight_type>& values) {
+                index_type best = 0;
+                for (index_type node = 0; node != node_count; ++node)
+                    if (values[node] != infinity_weight && (values[best] == infinity_weight || values[node] > values[best]))
+                        best = node;
+
+                return best;
+            };
+
+            if (landmark_count == 0)
+                return;
+
+            // the first landmark is the node farthest from an arbitrary node
+            detail::shortest_distances(graph, index_type {}, distances);
+            add_landmark(farthest(distances));
+            while (landmarks_.size() != landmark_count)
+            {
+                index_type landmark = farthest(coverage);
+                if (selection == landmark_selection::avoid)
+                {
+                    seed = seed * 1664525u + 1013904223u;
+                    landmark = avoid(graph, static_cast<index_type>(seed % node_count), from, to, distances, parents, order).value_or(landmark);
+                }
+
+                if (std::find(landmarks_.begin(), landmarks_.end(), landmark) != landmarks_.end())
+                    break;
+
+                add_landmark(landmark);
+            }
+        }
+
+        /// Finds the next landmark by the avoid method, starting from the given root.
+        std::optional<index_type> avoid(const view_type& graph, const index_type root, const std::vector<std::vector<weight_type>>& from,
+                                        const std::vector<std::vector<weight_type>>& to, std::vector<weight_type>& distances,
+                                        std::vector<index_type>& parents, std::vector<index_type>& order) const
+        {
+            constexpr auto infinity_weight = std::numeric_limits<weight_type>::max();
+            constexpr auto no_parent = ~index_type {};
+            detail::shortest_distances(graph, root, distances, &parents, &order);
+
+            // size of the subtree: the sum of the bound errors, or 0 if the subtree contains a landmark
+            std::vector<double> sizes(graph.node_count());
+            std::vector<index_type> best_children(graph.node_count(), no_parent);
+            std::vector<std::uint8_t> covered(graph.node_count());
+            for (const auto landmark: landmarks_)
+                covered[landmark] = 1;
+
+            for (auto node = order.rbegin(); node != order.rend(); ++node)
+            {
+                double bound = 0;
+                for (std::size_t i = 0; i != from.size(); ++i)
+                {
+                    if (from[i][*node] != infinity_weight && from[i][root] != infinity_weight)
+                        bound = std::max(bound, static_cast<double>(from[i][*node]) - static_cast<double>(from[i][root]));
+
+                    if (!to.empty() && to[i][*node] != infinity_weight && to[i][root] != infinity_weight)
+                        bound = std::max(bound, static_cast<double>(to[i][root]) - static_cast<double>(to[i][*node]));
+                    else if (to.empty() && from[i][*node] != infinity_weight && from[i][root] != infinity_weight)
+                        bound = std::max(bound, static_cast<double>(from[i][root]) - static_cast<double>(from[i][*node]));
+                }
+
+                sizes[*node] = covered[*node] ? 0 : sizes[*node] + static_cast<double>(distances[*node]) - bound;
+                const auto parent = parents[*node];
+                if (parent == no_parent)
+                    continue;
+
+                if (covered[*node])
+                    covered[parent] = 1;
+
+                sizes[parent] += sizes[*node];
+                if (best_children[parent] == no_parent || sizes[*node] > sizes[best_children[parent]])
+                    best_children[parent] = *node;
+            }
+
+            // the root subtree contains the landmarks, so the descent starts with its best child
+            auto leaf = root;
+            while (best_children[leaf] != no_parent && sizes[best_children[leaf]] > 0)
+                leaf = best_children[leaf];
+
+            return leaf != root ? std::optional<index_type>(leaf) : std::nullopt;
+        }
+
+        std::pmr::vector<index_type> landmarks_;
+        std::pmr::vector<distance_type> distances_;
+        std::size_t padded_count_ {};
+        std::size_t stride_ {};
+        double unit_ = 1;
+        bool exact_ = true;
+    };
+
+    /// @brief Node of a @ref csr_view graph using the ALT heuristic of a @ref landmark_table.
+    /// @note The node refers to the graph view and to the landmark table, which have to outlive it.
+    template <typename _Score = float, typename _Index = std::uint32_t, typename _Distance = std::uint16_t>
+    class alt_node: public csr_node<_Score, _Index>
+    {
+    public:
+        using score_type = _Score;
+        using index_type = _Index;
+        using base_type = csr_node<score_type, index_type>;
+        using view_type = typename base_type::view_type;
+        using landmark_table_type = landmark_table<score_type, index_type, _Distance>;
+
+        alt_node() = default;
+
+        alt_node(const view_type& graph, const landmark_table_type& landmarks, const index_type id) noexcept:
+            base_type(graph, id),
+            landmarks_(&landmarks)
+        {
+        }
+
+        alt_node(view_type&& graph, const landmark_table_type& landmarks, index_type id) = delete;
+
+        void set_heuristic_score(score_type, const alt_node& target_node) noexcept
+        {
+            base_type::base_type::set_heuristic_score(landmarks_->heuristic(this->id_, target_node.id_));
+        }
+
+    protected:
+        const landmark_table_type* landmarks_ {};
+    };
+
+    /// A* algorithm on a @ref csr_view graph using the ALT heuristic, with a @ref dense_node_table as open set,
+    /// closed set and solution map.
+    template <typename _Score = float, typename _Distance = std::uint16_t, typename _Table = dense_node_table<_Score>>
+    using alt_algo = algo<alt_node<_Score, std::uint32_t, _Distance>, dense_heap<alt_node<_Score, std::uint32_t, _Distance>, _Table>,
+                          csr_enumerator<alt_node<_Score, std::uint32_t, _Distance>>, _Table, target_id_verifier, _Table>;
+} // namespace stdext::astar
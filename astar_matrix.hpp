@@ -0,0 +1,191 @@
+/// A* One-to-Many and Many-to-Many Searches
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_batch.hpp"
+#include "astar_csr_graph.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <cstddef>
+    #include <limits>
+    #include <span>
+    #include <type_traits>
+    #include <unordered_map>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Solution verifier of the one-to-many searches: it settles the targets of a set as @ref algo expands them
+    /// and recognizes the solution when the last one is settled, so a single search gives the costs from the start
+    /// node to all the targets. The cost of a target is its general score when it is expanded, which is final for a
+    /// consistent heuristic admissible towards all the targets (e.g. 0, making the search a Dijkstra search).
+    /// @note algo::reset calls @ref set_target, which starts the next search unsettling all the targets; the target
+    /// node of the algorithm is only used by the heuristic.
+    template <typename _Score, typename _NodeIndex = node_index>
+    class target_set_verifier
+    {
+    public:
+        using score_type = _Score;
+        using node_index_type = _NodeIndex;
+
+        static constexpr score_type infinity = std::numeric_limits<score_type>::max();
+
+        target_set_verifier() = default;
+
+        /// @param[in] targets Range of target nodes; duplicates are allowed
+        template <typename _Nodes>
+        explicit target_set_verifier(const _Nodes& targets, node_index_type node_index = {}): node_index_(std::move(node_index))
+        {
+            for (const auto& node: targets)
+            {
+                const auto [found, inserted] = slots_.try_emplace(node_index_(node), costs_.size());
+                if (inserted)
+                    costs_.push_back(infinity);
+
+                targets_.push_back(found->second);
+            }
+
+            remaining_ = costs_.size();
+        }
+
+        bool operator()(const auto& node)
+        {
+            const auto found = slots_.find(node_index_(node));
+            if (found != slots_.end() && costs_[found->second] == infinity)
+            {
+                costs_[found->second] = node.general_score();
+                --remaining_;
+            }
+
+            return remaining_ == 0;
+        }
+
+        /// Unsettles all the targets for the next search.
+        void set_target(const auto&) noexcept
+        {
+            std::fill(costs_.begin(), costs_.end(), infinity);
+            remaining_ = costs_.size();
+        }
+
+        /// Gets the number of targets, the duplicates included.
+        std::size_t target_count() const noexcept { return targets_.size(); }
+
+        /// Gets the number of distinct targets not settled yet.
+        std::size_t remaining() const noexcept { return remaining_; }
+
+        /// Gets the cost of the target having the given position in the target range, or @ref infinity if it was
+        /// not settled (e.g. it is unreachable).
+        score_type cost(const std::size_t target) const noexcept { return costs_[targets_[target]]; }
+
+    private:
+        node_index_type node_index_;
+        std::unordered_map<std::size_t, std::size_t> slots_;
+        std::vector<std::size_t> targets_;
+        std::vector<score_type> costs_;
+        std::size_t remaining_ {};
+    };
+
+    /// Dense row-major matrix of the path costs from sources (rows) to targets (columns).
+    template <typename _Score>
+    class cost_matrix
+    {
+    public:
+        using score_type = _Score;
+
+        /// Cost of the pairs having no path.
+        static constexpr score_type infinity = std::numeric_limits<score_type>::max();
+
+        cost_matrix(const std::size_t rows, const std::size_t columns): values_(rows * columns, infinity), columns_(columns) {}
+
+        std::size_t rows() const noexcept { return columns_ != 0 ? values_.size() / columns_ : 0; }
+        std::size_t columns() const noexcept { return columns_; }
+
+        score_type& operator()(const std::size_t row, const std::size_t column) noexcept { return values_[row * columns_ + column]; }
+        score_type operator()(const std::size_t row, const std::size_t column) const noexcept { return values_[row * columns_ + column]; }
+
+        std::span<const score_type> values() const noexcept { return values_; }
+
+    private:
+        std::vector<score_type> values_;
+        std::size_t columns_;
+    };
+
+    /// One-to-many search on a @ref csr_view graph: a Dijkstra search (the nodes have no heuristic) stopping once
+    /// all the targets of its @ref target_set_verifier are settled.
+    template <typename _Score = float, typename _Table = dense_node_table<_Score>>
+    using csr_one_to_many_algo =
+        algo<csr_node<_Score>, dense_heap<csr_node<_Score>, _Table>, csr_enumerator<csr_node<_Score>>, _Table, target_set_verifier<_Score>, _Table>;
+
+    /// @brief Computes the costs of the shortest paths from all the sources to all the targets of a @ref csr_view graph
+    /// with the bucket method: the searches run from the smaller side, one one-to-many search per node of that
+    /// side, towards the nodes of the other side, which act as buckets collecting the costs of a whole row (or
+    /// column) of the matrix. A search stops as soon as its last bucket is settled, so it explores only the ball
+    /// enclosing the other side instead of the whole graph, and N x M costs take min(N, M) searches.
+    /// @param[in] graph Graph view
+    /// @param[in] reverse_graph Reverse graph view (see @ref make_reverse_graph), used to search from the targets
+    /// when they are fewer than the sources; without it (null), the searches always start from the sources
+    /// @param[in] sources Ids of the source nodes
+    /// @param[in] targets Ids of the target nodes
+    /// @param[in] pool Thread pool running the searches in parallel (see @ref batch_solver); null runs them on the
+    /// calling thread, reusing a single algorithm instance
+    /// @return Returns the matrix having a row per source and a column per target; unreachable pairs are infinity.
+    template <typename _Score, typename _Index>
+    cost_matrix<_Score> many_to_many(const csr_view<_Score, _Index>& graph, const csr_view<_Score, _Index>* const reverse_graph,
+                                     const std::span<const _Index> sources, const std::span<const _Index> targets,
+                                     work_stealing_pool* const pool = nullptr)
+    {
+        using algo_type = csr_one_to_many_algo<_Score>;
+        using node_type = typename algo_type::node_type;
+        static_assert(std::is_same_v<_Index, typename node_type::index_type>, "the graph has to use the index type of csr_node");
+
+        cost_matrix<_Score> result(sources.size(), targets.size());
+        if (sources.empty() || targets.empty())
+            return result;
+
+        const bool backward = reverse_graph && targets.size() < sources.size();
+        const auto& view = backward ? *reverse_graph : graph;
+        const auto starts = backward ? targets : sources;
+        const auto buckets = backward ? sources : targets;
+
+        std::vector<node_type> bucket_nodes;
+        bucket_nodes.reserve(buckets.size());
+        for (const auto id: buckets)
+            bucket_nodes.emplace_back(view, id, 0.0f);
+
+        const target_set_verifier<_Score> verifier(bucket_nodes);
+        const auto store = [&](const std::size_t start, const algo_type& as_algo) {
+            const auto& settled = as_algo.solution_verifier();
+            for (std::size_t bucket = 0; bucket != buckets.size(); ++bucket)
+                (backward ? result(bucket, start) : result(start, bucket)) = settled.cost(bucket);
+        };
+
+        const auto make_node = [&](const _Index id) { return node_type(view, id, 0.0f); };
+        if (pool)
+        {
+            using solver_type = batch_solver<algo_type>;
+            std::vector<typename solver_type::query> queries;
+            queries.reserve(starts.size());
+            for (const auto id: starts)
+                queries.push_back({make_node(id), make_node(id)});
+
+            solver_type solver(*pool, [&](const node_type& start_node, const node_type& target_node, std::pmr::memory_resource* const resource) {
+                return algo_type(start_node, target_node, verifier, csr_enumerator<node_type>(view), {}, resource);
+            });
+            solver.solve(queries, store);
+            return result;
+        }
+
+        algo_type as_algo(make_node(starts.front()), make_node(starts.front()), verifier, csr_enumerator<node_type>(view), {});
+        for (std::size_t start = 0; start != starts.size(); ++start)
+        {
+            if (start != 0)
+                as_algo.reset(make_node(starts[start]), make_node(starts[start]));
+
+            as_algo.run_steps(std::numeric_limits<std::size_t>::max());
+            store(start, as_algo);
+        }
+
+        return result;
+    }
+} // namespace stdext::astar
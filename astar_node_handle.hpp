@@ -0,0 +1,114 @@
+/// A* Node Handles
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_node_table.hpp"
+#ifndef PCH
+    #include <type_traits>
+    #include <utility>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Compact handle of a node kept in user storage. The algorithm copies the handle (a pointer to the node
+    /// and the score snapshot used as priority key) through the priority queue instead of the whole node, so no push
+    /// copies the node data (e.g. an adjacency vector). The scores set by the algorithm are mirrored into the node.
+    /// @note The handle is trivially copyable and is identified by the id of the node, so it fits the index based
+    /// containers: @ref dense_node_table and @ref indexed_dary_heap.
+    template <typename _Node>
+    class node_handle: public base_node<typename _Node::score_type>
+    {
+    public:
+        using node_type = _Node;
+        using score_type = typename node_type::score_type;
+        using base_type = base_node<score_type>;
+
+        node_handle() = default;
+
+        node_handle(node_type& node) noexcept: node_(&node)
+        {
+            this->general_score_ = node.general_score();
+            this->heuristic_score_ = node.heuristic_score();
+        }
+
+        /// Gets the referred node.
+        node_type& get() const noexcept { return *node_; }
+        node_type& operator*() const noexcept { return *node_; }
+        node_type* operator->() const noexcept { return node_; }
+        operator node_type&() const noexcept { return *node_; }
+
+        auto id() const noexcept { return node_->id(); }
+
+        auto distance_to(const node_handle& node) const { return node_->distance_to(*node.node_); }
+
+        void set_general_score(const score_type value) noexcept
+        {
+            base_type::set_general_score(value);
+            node_->set_general_score(value);
+        }
+
+        void set_heuristic_score(const score_type general_score, const node_handle& target_node)
+        {
+            node_->set_heuristic_score(general_score, *target_node.node_);
+            base_type::set_heuristic_score(node_->heuristic_score());
+        }
+
+        /// Overrides the heuristic score, e.g. with a score cached by @ref dense_node_table or inflated by the
+        /// weighted A* epsilon of @ref algo.
+        void set_heuristic_score(const score_type value) noexcept
+        {
+            base_type::set_heuristic_score(value);
+            static_cast<base_node<score_type>&>(*node_).set_heuristic_score(value);
+        }
+
+    private:
+        node_type* node_ {};
+    };
+
+    /// Adapts a neighbor enumerator yielding nodes from user storage to yield @ref node_handle instances.
+    template <typename _NeighborEnumerator>
+    class handle_enumerator
+    {
+    public:
+        using enumerator_type = _NeighborEnumerator;
+        using node_type = std::remove_reference_t<decltype(*std::declval<enumerator_type&>())>;
+        using handle_type = node_handle<node_type>;
+
+        handle_enumerator(enumerator_type enumerator): enumerator_(std::move(enumerator)) {}
+
+        operator bool() const noexcept { return static_cast<bool>(enumerator_); }
+
+        void operator()(const handle_type& node) { enumerator_(*node); }
+
+        void operator++() { ++enumerator_; }
+
+        handle_type& operator*()
+        {
+            current_ = handle_type(*enumerator_);
+            return current_;
+        }
+
+        /// Gets the edge cost yielded by the adapted enumerator, if it is a @ref weighted_enumerator.
+        auto cost() const requires requires(const enumerator_type& enumerator) { enumerator.cost(); } { return enumerator_.cost(); }
+
+        void set_target(const handle_type& target_node)
+        {
+            if constexpr (requires { enumerator_.set_target(*target_node); })
+                enumerator_.set_target(*target_node);
+        }
+
+        /// Gets the adapted enumerator.
+        enumerator_type& base() noexcept { return enumerator_; }
+
+    private:
+        enumerator_type enumerator_;
+        handle_type current_;
+    };
+
+    /// A* algorithm moving @ref node_handle instances instead of nodes, using a @ref dense_node_table as open set,
+    /// closed set and solution map.
+    template <typename _Node, typename _NeighborEnumerator, typename _SolutionVerifier,
+              typename _Table = dense_node_table<typename _Node::score_type>, typename _BeamSearch = no_beam_search>
+    using handle_algo = algo<node_handle<_Node>, dense_heap<node_handle<_Node>, _Table>, handle_enumerator<_NeighborEnumerator>, _Table,
+                             _SolutionVerifier, _Table, _BeamSearch>;
+} // namespace stdext::astar
@@ -0,0 +1,312 @@
+/// A* Dense Node Table
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_priority_queue.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <cstdint>
+    #include <limits>
+    #include <memory_resource>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// State of a node in a @ref dense_node_table.
+    enum class node_state : std::uint8_t
+    {
+        unvisited,
+        open,
+        closed
+    };
+
+    /// Heuristic cache mode of a @ref dense_node_table.
+    enum class heuristic_cache : std::uint8_t
+    {
+        /// The heuristic is evaluated on each relaxation.
+        disabled,
+        /// The heuristic is evaluated at most once per node and query.
+        per_query,
+        /// The heuristic is evaluated at most once per node while the queries share the target node.
+        per_target
+    };
+
+    /// @brief Dense node table - the per node state of the algorithm kept in one contiguous record per node,
+    /// addressed by the 32-bit dense index of the node (see @ref node_index). Used as both _Set and _SolutionMap of
+    /// @ref algo, it replaces the open set, the closed set and the solution map, so each relaxed neighbor touches a
+    /// single record instead of several associative containers.
+    /// @note The table grows on demand; @ref reserve avoids the reallocations when the node count is known.
+    /// @note Each record is stamped with the generation (query) which wrote it. Clearing the table only starts a new
+    /// generation, which makes all the records of the previous queries invisible, so it is O(1) and keeps the memory.
+    /// @note The heuristic scores can be cached (see @ref set_heuristic_cache) in a separate array, stamped with their
+    /// own generation, so they may outlive the queries sharing the same target node.
+    template <typename _Score, typename _NodeIndex = node_index, typename _Index = std::uint32_t>
+    class dense_node_table
+    {
+    public:
+        using score_type = _Score;
+        using node_index_type = _NodeIndex;
+        using index_type = _Index;
+        using size_type = std::size_t;
+        using position_type = std::uint32_t;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        static constexpr index_type npos = ~index_type {};
+
+        /// Per node record.
+        struct record
+        {
+            /// Best known general score (g).
+            score_type general_score {};
+
+            /// Index of the parent node on the best known path.
+            index_type parent = npos;
+
+            /// Position of the node in the priority queue (see @ref table_heap_positions).
+            position_type heap_position = ~position_type {};
+
+            /// Generation which wrote the record.
+            std::uint32_t generation {};
+
+            node_state state = node_state::unvisited;
+        };
+
+        dense_node_table(const size_type node_count = 0, node_index_type node_index = {}, const allocator_type& allocator = {}):
+            records_(allocator),
+            heuristics_(allocator),
+            node_index_(std::move(node_index))
+        {
+            reserve(node_count);
+        }
+
+        explicit dense_node_table(const allocator_type& allocator): records_(allocator), heuristics_(allocator) {}
+
+        /// Checks if there are no open nodes.
+        bool empty() const noexcept { return open_count_ == 0; }
+
+        /// Gets the number of open nodes.
+        size_type open_count() const noexcept { return open_count_; }
+
+        /// Gets the number of records.
+        size_type size() const noexcept { return records_.size(); }
+
+        /// Makes room for the records of the given number of nodes.
+        void reserve(const size_type node_count)
+        {
+            if (node_count > records_.size())
+                records_.resize(node_count);
+        }
+
+        /// Marks all nodes as unvisited by starting a new generation. The records are rewritten only when the
+        /// generation counter wraps around.
+        void clear() noexcept
+        {
+            if (++generation_ == 0)
+            {
+                std::fill(records_.begin(), records_.end(), record {});
+                generation_ = 1;
+            }
+
+            open_count_ = 0;
+        }
+
+        /// Gets the current generation.
+        std::uint32_t generation() const noexcept { return generation_; }
+
+        /// Gets the dense index of the node.
+        index_type index(const auto& node) const noexcept { return static_cast<index_type>(node_index_(node)); }
+
+        /// Gets the record of the node having the given index. The records of the previous generations are seen as
+        /// unvisited.
+        const record& at(const index_type index) const noexcept
+        {
+            static const record unvisited;
+            return visible(index) ? records_[index] : unvisited;
+        }
+
+        node_state state(const index_type index) const noexcept { return at(index).state; }
+        node_state state(const auto& node) const noexcept { return state(index(node)); }
+
+        bool is_open(const auto& node) const noexcept { return state(node) == node_state::open; }
+        bool is_closed(const auto& node) const noexcept { return state(node) == node_state::closed; }
+
+        /// Gets the best known general score of a visited node.
+        score_type general_score(const auto& node) const noexcept { return at(index(node)).general_score; }
+
+        /// Gets the bound a tentative general score of the node having the given index has to be lower than to relax
+        /// the node: the best known general score of an open node, the lowest score of a closed node and the highest
+        /// score of an unvisited node.
+        score_type relax_limit(const index_type index) const noexcept
+        {
+            const auto& item = at(index);
+            switch (item.state)
+            {
+            case node_state::open:
+                return item.general_score;
+            case node_state::closed:
+                return std::numeric_limits<score_type>::lowest();
+            default:
+                return std::numeric_limits<score_type>::max();
+            }
+        }
+
+        /// Marks the node as open having the given general score.
+        void open(const auto& node, const score_type general_score)
+        {
+            auto& item = fetch(index(node));
+            if (item.state != node_state::open)
+            {
+                item.state = node_state::open;
+                ++open_count_;
+            }
+
+            item.general_score = general_score;
+        }
+
+        /// Marks the node as closed.
+        void close(const auto& node)
+        {
+            auto& item = fetch(index(node));
+            if (item.state == node_state::open)
+                --open_count_;
+
+            item.state = node_state::closed;
+        }
+
+        /// Sets the parent of the node on the best known path.
+        void set_parent(const auto& node, const auto& parent) { fetch(index(node)).parent = index(parent); }
+
+        /// Sets the parent of the node having the given index.
+        void link(const index_type index, const index_type parent) { fetch(index).parent = parent; }
+
+        /// Gets the index of the parent node or @ref npos if the node has no parent.
+        index_type parent(const index_type index) const noexcept { return at(index).parent; }
+
+        /// Gets the indexes of the nodes on the path ending with the given node, from the start node to it.
+        std::vector<index_type> path(const auto& node) const
+        {
+            std::vector<index_type> result;
+            for (auto current = index(node); current != npos; current = parent(current))
+                result.push_back(current);
+
+            std::reverse(result.begin(), result.end());
+            return result;
+        }
+
+        /// Sets the heuristic cache mode, dropping the cached scores.
+        void set_heuristic_cache(const heuristic_cache mode)
+        {
+            heuristic_cache_ = mode;
+            invalidate_heuristics();
+        }
+
+        heuristic_cache heuristic_cache_mode() const noexcept { return heuristic_cache_; }
+
+        /// Declares the target node of the next query. The cached heuristic scores are dropped unless they are kept
+        /// per target and the target did not change.
+        void set_heuristic_target(const index_type target)
+        {
+            if (heuristic_cache_ != heuristic_cache::per_target || target != heuristic_target_)
+                invalidate_heuristics();
+
+            heuristic_target_ = target;
+        }
+
+        /// Gets the cached heuristic score of the node having the given index, calling compute() to evaluate it
+        /// when it is not cached.
+        template <typename _Compute>
+        score_type heuristic_score(const index_type index, _Compute&& compute)
+        {
+            if (heuristic_cache_ == heuristic_cache::disabled)
+                return compute();
+
+            if (index >= heuristics_.size())
+                heuristics_.resize(std::max<size_type>(size_type {index} + 1, heuristics_.size() * 2));
+
+            auto& item = heuristics_[index];
+            if (item.generation != heuristic_generation_)
+            {
+                item.score = compute();
+                item.generation = heuristic_generation_;
+            }
+
+            return item.score;
+        }
+
+        position_type heap_position(const size_type index) const noexcept { return at(static_cast<index_type>(index)).heap_position; }
+
+        void set_heap_position(const size_type index, const position_type position)
+        {
+            fetch(static_cast<index_type>(index)).heap_position = position;
+        }
+
+    protected:
+        struct cached_heuristic
+        {
+            score_type score {};
+            std::uint32_t generation {};
+        };
+
+        void invalidate_heuristics() noexcept
+        {
+            if (++heuristic_generation_ == 0)
+            {
+                std::fill(heuristics_.begin(), heuristics_.end(), cached_heuristic {});
+                heuristic_generation_ = 1;
+            }
+        }
+
+        bool visible(const index_type index) const noexcept { return index < records_.size() && records_[index].generation == generation_; }
+
+        /// Gets the record of the current generation, resetting it if it was written by a previous one.
+        record& fetch(const index_type index)
+        {
+            if (index >= records_.size())
+                records_.resize(std::max<size_type>(size_type {index} + 1, records_.size() * 2));
+
+            auto& item = records_[index];
+            if (item.generation != generation_)
+            {
+                item = {};
+                item.generation = generation_;
+            }
+
+            return item;
+        }
+
+        std::pmr::vector<record> records_;
+        std::pmr::vector<cached_heuristic> heuristics_;
+        size_type open_count_ {};
+        std::uint32_t generation_ {1};
+        std::uint32_t heuristic_generation_ {1};
+        index_type heuristic_target_ = npos;
+        heuristic_cache heuristic_cache_ = heuristic_cache::disabled;
+        node_index_type node_index_;
+    };
+
+    /// Position handles of an @ref indexed_dary_heap kept in the records of a node table. The table is attached by
+    /// @ref algo, which uses the same table as _Set.
+    template <typename _Table>
+    class table_heap_positions
+    {
+    public:
+        using table_type = _Table;
+        using position_type = typename table_type::position_type;
+
+        static constexpr position_type npos = ~position_type {};
+
+        void attach(table_type& table) noexcept { table_ = &table; }
+
+        position_type position(const std::size_t index) const noexcept { return table_->heap_position(index); }
+        void set_position(const std::size_t index, const position_type position) { table_->set_heap_position(index, position); }
+        void reserve(const std::size_t node_count) { table_->reserve(node_count); }
+
+    private:
+        table_type* table_ {};
+    };
+
+    /// Indexed d-ary heap keeping the position handles in the given node table.
+    template <typename _Node, typename _Table = dense_node_table<typename _Node::score_type>, std::size_t _Arity = 4>
+    using dense_heap = indexed_dary_heap<_Node, _Arity, typename _Table::node_index_type, std::greater<>, table_heap_positions<_Table>>;
+} // namespace stdext::astar
@@ -0,0 +1,571 @@
+/// A* Priority Queues
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_algo.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <bit>
+    #include <cstdint>
+    #include <functional>
+    #include <iterator>
+    #include <limits>
+    #include <memory_resource>
+    #include <queue>
+    #include <span>
+    #include <type_traits>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// Position handles of the nodes queued in an @ref indexed_dary_heap, owned by the heap and addressed by the
+    /// dense node index.
+    class heap_positions
+    {
+    public:
+        using position_type = std::uint32_t;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        static constexpr position_type npos = ~position_type {};
+
+        heap_positions() = default;
+        explicit heap_positions(const allocator_type& allocator): positions_(allocator) {}
+
+        position_type position(const std::size_t index) const noexcept { return index < positions_.size() ? positions_[index] : npos; }
+
+        void set_position(const std::size_t index, const position_type position)
+        {
+            if (index >= positions_.size())
+                positions_.resize(std::max(index + 1, positions_.size() * 2), npos);
+
+            positions_[index] = position;
+        }
+
+        void reserve(const std::size_t node_count)
+        {
+            if (node_count > positions_.size())
+                positions_.resize(node_count, npos);
+        }
+
+    private:
+        std::pmr::vector<position_type> positions_;
+    };
+
+    /// @brief Indexed d-ary heap usable as _PriorityQueue of @ref algo. Each queued node has a position handle
+    /// addressed by its dense index (see @ref node_index), so a node is never queued twice: pushing a queued node
+    /// or calling @ref decrease_key replaces its entry and restores the heap order.
+    /// @note The default comparator (std::greater) keeps the node with the lowest total score on top.
+    /// @note The position handles are kept by the _Positions policy: by default in the heap itself
+    /// (@ref heap_positions), or in the records of a node table (see table_heap_positions).
+    template <typename _Node, std::size_t _Arity = 4, typename _NodeIndex = node_index, typename _Compare = std::greater<>,
+              typename _Positions = heap_positions>
+    class indexed_dary_heap
+    {
+        static_assert(_Arity >= 2, "the heap arity has to be at least 2");
+
+    public:
+        using value_type = _Node;
+        using size_type = std::size_t;
+        using node_index_type = _NodeIndex;
+        using compare_type = _Compare;
+        using positions_type = _Positions;
+        using position_type = typename positions_type::position_type;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        static constexpr size_type arity = _Arity;
+        static constexpr position_type npos = positions_type::npos;
+
+        indexed_dary_heap(node_index_type node_index = {}, compare_type compare = {}):
+            node_index_(std::move(node_index)),
+            compare_(std::move(compare))
+        {
+        }
+
+        explicit indexed_dary_heap(const allocator_type& allocator, node_index_type node_index = {}, compare_type compare = {}):
+            items_(allocator),
+            positions_(detail::make_with_allocator<positions_type>(allocator)),
+            node_index_(std::move(node_index)),
+            compare_(std::move(compare))
+        {
+        }
+
+        bool empty() const noexcept { return items_.empty(); }
+        size_type size() const noexcept { return items_.size(); }
+
+        /// Gets the node with the highest priority.
+        const value_type& top() const noexcept { return items_.front(); }
+
+        /// Gets the queued nodes in heap order.
+        std::span<const value_type> items() const noexcept { return items_; }
+
+        /// Gets the position handles.
+        positions_type& positions() noexcept { return positions_; }
+
+        /// Checks if the node is queued.
+        bool contains(const value_type& node) const noexcept { return position(node_index_(node)) != npos; }
+
+        /// Queues the node or updates its entry if it is already queued.
+        void push(value_type node)
+        {
+            const auto pos = position(node_index_(node));
+            if (pos != npos)
+            {
+                update(pos, std::move(node));
+                return;
+            }
+
+            items_.push_back(std::move(node));
+            sift_up(static_cast<position_type>(items_.size() - 1));
+        }
+
+        /// Replaces the entry of a queued node with a higher priority one; a node which is not queued is pushed.
+        void decrease_key(value_type node)
+        {
+            const auto pos = position(node_index_(node));
+            if (pos == npos)
+            {
+                items_.push_back(std::move(node));
+                sift_up(static_cast<position_type>(items_.size() - 1));
+                return;
+            }
+
+            items_[pos] = std::move(node);
+            sift_up(pos);
+        }
+
+        /// Removes the node with the highest priority.
+        void pop()
+        {
+            positions_.set_position(node_index_(items_.front()), npos);
+            if (items_.size() > 1)
+            {
+                items_.front() = std::move(items_.back());
+                items_.pop_back();
+                sift_down(0);
+            }
+            else
+                items_.pop_back();
+        }
+
+        /// Removes the node from the heap if it is queued.
+        void erase(const value_type& node)
+        {
+            const auto index = node_index_(node);
+            const auto pos = position(index);
+            if (pos == npos)
+                return;
+
+            positions_.set_position(index, npos);
+            if (pos + size_type {1} == items_.size())
+            {
+                items_.pop_back();
+                return;
+            }
+
+            items_[pos] = std::move(items_.back());
+            items_.pop_back();
+            if (pos != 0 && compare_(items_[(pos - 1) / arity], items_[pos]))
+                sift_up(pos);
+            else
+                sift_down(pos);
+        }
+
+        /// Removes all nodes keeping the allocated memory. The complexity is linear in the number of queued nodes.
+        void clear() noexcept
+        {
+            for (const auto& item: items_)
+                positions_.set_position(node_index_(item), npos);
+
+            items_.clear();
+        }
+
+        /// Reserves memory for the given number of queued nodes and node indexes.
+        void reserve(const size_type node_count)
+        {
+            items_.reserve(node_count);
+            positions_.reserve(node_count);
+        }
+
+    protected:
+        position_type position(const size_type index) const noexcept { return positions_.position(index); }
+
+        void place(const position_type pos, value_type&& node)
+        {
+            items_[pos] = std::move(node);
+            positions_.set_position(node_index_(items_[pos]), pos);
+        }
+
+        void update(const position_type pos, value_type&& node)
+        {
+            const bool lower_priority = compare_(node, items_[pos]);
+            items_[pos] = std::move(node);
+            if (lower_priority)
+                sift_down(pos);
+            else
+                sift_up(pos);
+        }
+
+        void sift_up(position_type pos)
+        {
+            value_type node = std::move(items_[pos]);
+            while (pos != 0)
+            {
+                const position_type parent = (pos - 1) / arity;
+                if (!compare_(items_[parent], node))
+                    break;
+
+                place(pos, std::move(items_[parent]));
+                pos = parent;
+            }
+
+            place(pos, std::move(node));
+        }
+
+        void sift_down(position_type pos)
+        {
+            const size_type count = items_.size();
+            value_type node = std::move(items_[pos]);
+            for (;;)
+            {
+                const size_type first_child = pos * arity + 1;
+                if (first_child >= count)
+                    break;
+
+                size_type best_child = first_child;
+                const size_type last_child = std::min(first_child + arity, count);
+                for (size_type child = first_child + 1; child < last_child; ++child)
+                    if (compare_(items_[best_child], items_[child]))
+                        best_child = child;
+
+                if (!compare_(node, items_[best_child]))
+                    break;
+
+                place(pos, std::move(items_[best_child]));
+                pos = static_cast<position_type>(best_child);
+            }
+
+            place(pos, std::move(node));
+        }
+
+        std::pmr::vector<value_type> items_;
+        positions_type positions_;
+        node_index_type node_index_;
+        compare_type compare_;
+    };
+
+    template <typename _Node, typename _NodeIndex = node_index>
+    using quaternary_heap = indexed_dary_heap<_Node, 4, _NodeIndex>;
+
+    template <typename _Node, typename _NodeIndex = node_index>
+    using octonary_heap = indexed_dary_heap<_Node, 8, _NodeIndex>;
+
+    namespace detail
+    {
+        /// Maps an integral score to an unsigned key preserving the order (the negative scores included).
+        template <std::integral _Score>
+        constexpr std::make_unsigned_t<_Score> monotone_key(const _Score score) noexcept
+        {
+            using key_type = std::make_unsigned_t<_Score>;
+            if constexpr (std::is_signed_v<_Score>)
+                return static_cast<key_type>(score) ^ (key_type {1} << (std::numeric_limits<key_type>::digits - 1));
+            else
+                return score;
+        }
+    }
+
+    /// @brief Monotone radix heap for integral scores usable as _PriorityQueue of @ref algo. The node keys are
+    /// spread into buckets by the most significant bit which differs from the last extracted key, so push is O(1) and
+    /// pop is amortized O(log C) where C is the range of the scores.
+    /// @note The heap is meant for monotone total scores (not lower than the score of the top node), which holds for
+    /// consistent heuristics. A lower score is still ordered correctly but costs a linear rebuild of the buckets.
+    template <typename _Node>
+    class radix_heap
+    {
+    public:
+        using value_type = _Node;
+        using size_type = std::size_t;
+        using score_type = typename value_type::score_type;
+        using key_type = std::make_unsigned_t<score_type>;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        static constexpr size_type bucket_count = std::numeric_limits<key_type>::digits + 1;
+
+        radix_heap(): radix_heap(allocator_type {}) {}
+        explicit radix_heap(const allocator_type& allocator): buckets_(bucket_count, allocator), rebased_(allocator) {}
+
+        bool empty() const noexcept { return size_ == 0; }
+        size_type size() const noexcept { return size_; }
+
+        /// Gets the node with the lowest total score.
+        const value_type& top() const
+        {
+            normalize();
+            return buckets_.front().back().second;
+        }
+
+        /// Gets the key of the node with the lowest total score.
+        key_type top_key() const
+        {
+            normalize();
+            return last_;
+        }
+
+        void push(value_type node)
+        {
+            const auto key = detail::monotone_key(node.total_score());
+            push(key, std::move(node));
+        }
+
+        /// Queues the node using the given (already mapped) key.
+        void push(const key_type key, value_type node)
+        {
+            if (size_ == 0)
+                last_ = key;
+            else if (key < last_)
+                rebase(key);
+
+            buckets_[bucket(key)].emplace_back(key, std::move(node));
+            ++size_;
+        }
+
+        void pop()
+        {
+            normalize();
+            buckets_.front().pop_back();
+            --size_;
+        }
+
+        /// Removes the nodes having keys lower than the bound, in ascending key order, passing their key and the node
+        /// to the sink. The remaining nodes are not redistributed, so pushing keys at least equal to the bound stays
+        /// cheap.
+        template <typename _Sink>
+        void drain_below(const key_type bound, _Sink&& sink)
+        {
+            while (size_ != 0)
+            {
+                if (buckets_.front().empty())
+                {
+                    const auto source = first_used_bucket();
+                    const auto key = min_key(*source);
+                    if (key >= bound)
+                        break;
+
+                    redistribute(source, key);
+                }
+                else if (last_ >= bound)
+                    break;
+
+                auto& entry = buckets_.front().back();
+                sink(entry.first, std::move(entry.second));
+                buckets_.front().pop_back();
+                --size_;
+            }
+        }
+
+        /// Removes all nodes keeping the allocated memory.
+        void clear() noexcept
+        {
+            for (auto& bucket: buckets_)
+                bucket.clear();
+
+            size_ = 0;
+        }
+
+    protected:
+        using entry_type = std::pair<key_type, value_type>;
+        using bucket_type = std::pmr::vector<entry_type>;
+        using bucket_iterator = typename std::pmr::vector<bucket_type>::iterator;
+
+        size_type bucket(const key_type key) const noexcept { return static_cast<size_type>(std::bit_width(static_cast<key_type>(key ^ last_))); }
+
+        bucket_iterator first_used_bucket() const
+        {
+            return std::find_if(buckets_.begin() + 1, buckets_.end(), [](const auto& bucket) { return !bucket.empty(); });
+        }
+
+        static key_type min_key(const bucket_type& bucket)
+        {
+            return std::min_element(bucket.begin(), bucket.end(), [](const auto& a, const auto& b) { return a.first < b.first; })->first;
+        }
+
+        /// Moves the entries of the source bucket into the lower buckets, relative to their minimum key.
+        void redistribute(const bucket_iterator source, const key_type key) const
+        {
+            last_ = key;
+            for (auto& entry: *source)
+                buckets_[bucket(entry.first)].push_back(std::move(entry));
+
+            source->clear();
+        }
+
+        /// Redistributes all nodes relative to a key lower than the current reference key.
+        void rebase(const key_type key)
+        {
+            last_ = key;
+            for (auto& bucket: buckets_)
+            {
+                std::move(bucket.begin(), bucket.end(), std::back_inserter(rebased_));
+                bucket.clear();
+            }
+
+            for (auto& entry: rebased_)
+                buckets_[bucket(entry.first)].push_back(std::move(entry));
+
+            rebased_.clear();
+        }
+
+        /// Makes the first bucket hold the nodes with the lowest key. It is deferred until the top node is needed, so
+        /// the nodes pushed after a pop are compared with the popped key and not with the next one.
+        void normalize() const
+        {
+            if (buckets_.front().empty() && size_ != 0)
+            {
+                const auto source = first_used_bucket();
+                redistribute(source, min_key(*source));
+            }
+        }
+
+        mutable std::pmr::vector<bucket_type> buckets_;
+        bucket_type rebased_;
+        size_type size_ {};
+        mutable key_type last_ {};
+    };
+
+    /// @brief Monotone bucket queue (Dial's algorithm) for integral scores usable as _PriorityQueue of @ref algo.
+    /// The total scores within the window [top score, top score + _BucketCount) are kept in circular buckets, giving
+    /// O(1) push and pop. The scores beyond the window overflow into a @ref radix_heap and are moved into the buckets
+    /// as the window advances. The nodes having the same score are popped in LIFO order.
+    /// @note Like @ref radix_heap, the queue is meant for monotone total scores. A score lower than the window start
+    /// slides the window back, moving the nodes which leave it into the overflow heap.
+    template <typename _Node, std::size_t _BucketCount = 1024>
+    class bucket_queue
+    {
+        static_assert(std::has_single_bit(_BucketCount), "the bucket count has to be a power of two");
+
+    public:
+        using value_type = _Node;
+        using size_type = std::size_t;
+        using score_type = typename value_type::score_type;
+        using key_type = std::make_unsigned_t<score_type>;
+        using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+
+        static constexpr size_type bucket_count = _BucketCount;
+
+        bucket_queue(): bucket_queue(allocator_type {}) {}
+        explicit bucket_queue(const allocator_type& allocator): buckets_(bucket_count, allocator), overflow_(allocator) {}
+
+        bool empty() const noexcept { return size() == 0; }
+        size_type size() const noexcept { return count_ + overflow_.size(); }
+
+        /// Gets the node with the lowest total score.
+        const value_type& top() const
+        {
+            normalize();
+            return buckets_[base_ & mask].back();
+        }
+
+        void push(value_type node)
+        {
+            const auto key = detail::monotone_key(node.total_score());
+            if (empty())
+                base_ = key;
+            else if (key < base_)
+                rebase(key);
+
+            if (key - base_ < bucket_count)
+            {
+                buckets_[key & mask].push_back(std::move(node));
+                ++count_;
+            }
+            else
+                overflow_.push(key, std::move(node));
+        }
+
+        void pop()
+        {
+            normalize();
+            buckets_[base_ & mask].pop_back();
+            --count_;
+        }
+
+        /// Removes all nodes keeping the allocated memory.
+        void clear() noexcept
+        {
+            for (auto& bucket: buckets_)
+                bucket.clear();
+
+            overflow_.clear();
+            count_ = 0;
+        }
+
+    protected:
+        static constexpr key_type mask = static_cast<key_type>(bucket_count - 1);
+
+        /// Slides the window back to start at the given key.
+        void rebase(const key_type key)
+        {
+            const key_type first = base_ - key >= bucket_count ? static_cast<key_type>(base_ - bucket_count) : key;
+            for (key_type evicted = first; evicted != base_; ++evicted)
+            {
+                auto& bucket = buckets_[evicted & mask];
+                for (auto& node: bucket)
+                    overflow_.push(detail::monotone_key(node.total_score()), std::move(node));
+
+                count_ -= bucket.size();
+                bucket.clear();
+            }
+
+            base_ = key;
+        }
+
+        /// Advances the window to the lowest queued score and moves the overflown nodes which entered the window into
+        /// the buckets. Like in @ref radix_heap, it is deferred until the top node is needed.
+        void normalize() const
+        {
+            if (count_ == 0)
+            {
+                if (overflow_.empty())
+                    return;
+
+                base_ = overflow_.top_key();
+            }
+            else
+                while (buckets_[base_ & mask].empty())
+                    ++base_;
+
+            const key_type bound = base_ > std::numeric_limits<key_type>::max() - bucket_count ? std::numeric_limits<key_type>::max()
+                                                                                               : static_cast<key_type>(base_ + bucket_count);
+            overflow_.drain_below(bound, [this](const key_type key, value_type&& node) {
+                buckets_[key & mask].push_back(std::move(node));
+                ++count_;
+            });
+        }
+
+        mutable std::pmr::vector<std::pmr::vector<value_type>> buckets_;
+        mutable radix_heap<value_type> overflow_;
+        mutable size_type count_ {};
+        mutable key_type base_ {};
+    };
+
+    /// Selects the default priority queue of the nodes having the given score type: a @ref bucket_queue for the
+    /// integral scores and a binary heap (std::priority_queue over std::pmr::vector) for the others.
+    template <typename _Score>
+    struct priority_queue_traits
+    {
+        template <typename _Node>
+        using queue_type = std::priority_queue<_Node, std::pmr::vector<_Node>, std::greater<_Node>>;
+    };
+
+    template <typename _Score>
+        requires(std::integral<_Score> && !std::same_as<_Score, bool>)
+    struct priority_queue_traits<_Score>
+    {
+        template <typename _Node>
+        using queue_type = bucket_queue<_Node>;
+    };
+
+    /// Default priority queue of the given node type (see @ref priority_queue_traits).
+    template <typename _Node>
+    using default_priority_queue = typename priority_queue_traits<typename _Node::score_type>::template queue_type<_Node>;
+} // namespace stdext::astar
@@ -0,0 +1,107 @@
+/// A* SIMD Kernels
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define ASTAR_HAS_AVX2_DISPATCH 1
+#endif
+#ifndef PCH
+    #include <algorithm>
+    #include <cstddef>
+    #include <cstdint>
+    #include <type_traits>
+    #ifdef ASTAR_HAS_AVX2_DISPATCH
+        #include <immintrin.h>
+    #endif
+#endif
+
+namespace stdext::astar::detail
+{
+    /// Number of distances of the given type processed by an iteration of the vector kernels: 8 32-bit lanes, the
+    /// 16-bit distances being widened to 32 bits. The landmark rows are padded to it, so the kernels need no scalar
+    /// tail.
+    template <typename _Distance>
+    inline constexpr std::size_t landmark_lanes = std::is_same_v<_Distance, std::uint16_t> || std::is_same_v<_Distance, float> ? 8 : 1;
+
+    /// Scalar landmark bound: the maximum of target[i] - node[i] over [0, from_count) and of node[i] - target[i]
+    /// over [to_offset, to_offset + to_count), or 0 if all are negative.
+    template <typename _Distance>
+    auto landmark_bound_scalar(const _Distance* const target, const _Distance* const node, const std::size_t from_count,
+                               const std::size_t to_offset, const std::size_t to_count) noexcept
+    {
+        using difference_type = std::conditional_t<std::is_floating_point_v<_Distance>, _Distance, std::int64_t>;
+        difference_type bound {};
+        for (std::size_t i = 0; i != from_count; ++i)
+            bound = std::max(bound, difference_type(target[i]) - difference_type(node[i]));
+
+        for (std::size_t i = to_offset; i != to_offset + to_count; ++i)
+            bound = std::max(bound, difference_type(node[i]) - difference_type(target[i]));
+
+        return bound;
+    }
+
+#ifdef ASTAR_HAS_AVX2_DISPATCH
+    /// Checks once if the processor supports AVX2. The processor model is initialized explicitly, since the check
+    /// may run from the static initializer of another translation unit, before the one of libgcc.
+    inline bool cpu_has_avx2() noexcept
+    {
+        static const bool supported = [] {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2") != 0;
+        }();
+        return supported;
+    }
+
+    /// AVX2 landmark bound of 16-bit distances; the counts have to be multiples of 8.
+    __attribute__((target("avx2"))) inline std::int64_t landmark_bound_avx2(const std::uint16_t* const target, const std::uint16_t* const node,
+                                                                             const std::size_t from_count, const std::size_t to_offset,
+                                                                             const std::size_t to_count) noexcept
+    {
+        const auto load = [](const std::uint16_t* const items) { return _mm_loadu_si128(reinterpret_cast<const __m128i*>(items)); };
+        __m256i bound = _mm256_setzero_si256();
+        for (std::size_t i = 0; i != from_count; i += 8)
+            bound = _mm256_max_epi32(bound, _mm256_sub_epi32(_mm256_cvtepu16_epi32(load(target + i)), _mm256_cvtepu16_epi32(load(node + i))));
+
+        for (std::size_t i = to_offset; i != to_offset + to_count; i += 8)
+            bound = _mm256_max_epi32(bound, _mm256_sub_epi32(_mm256_cvtepu16_epi32(load(node + i)), _mm256_cvtepu16_epi32(load(target + i))));
+
+        __m128i half = _mm_max_epi32(_mm256_castsi256_si128(bound), _mm256_extracti128_si256(bound, 1));
+        half = _mm_max_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(1, 0, 3, 2)));
+        half = _mm_max_epi32(half, _mm_shuffle_epi32(half, _MM_SHUFFLE(2, 3, 0, 1)));
+        return _mm_cvtsi128_si32(half);
+    }
+
+    /// AVX2 landmark bound of float distances; the counts have to be multiples of 8.
+    __attribute__((target("avx2"))) inline float landmark_bound_avx2(const float* const target, const float* const node, const std::size_t from_count,
+                                                                      const std::size_t to_offset, const std::size_t to_count) noexcept
+    {
+        __m256 bound = _mm256_setzero_ps();
+        for (std::size_t i = 0; i != from_count; i += 8)
+            bound = _mm256_max_ps(bound, _mm256_sub_ps(_mm256_loadu_ps(target + i), _mm256_loadu_ps(node + i)));
+
+        for (std::size_t i = to_offset; i != to_offset + to_count; i += 8)
+            bound = _mm256_max_ps(bound, _mm256_sub_ps(_mm256_loadu_ps(node + i), _mm256_loadu_ps(target + i)));
+
+        __m128 half = _mm_max_ps(_mm256_castps256_ps128(bound), _mm256_extractf128_ps(bound, 1));
+        half = _mm_max_ps(half, _mm_movehl_ps(half, half));
+        half = _mm_max_ss(half, _mm_shuffle_ps(half, half, 1));
+        return _mm_cvtss_f32(half);
+    }
+#endif
+
+    /// Landmark bound (see @ref landmark_bound_scalar), computed by the AVX2 kernel when the processor supports it
+    /// and the counts are multiples of @ref landmark_lanes.
+    template <typename _Distance>
+    auto landmark_bound(const _Distance* const target, const _Distance* const node, const std::size_t from_count, const std::size_t to_offset,
+                        const std::size_t to_count) noexcept
+    {
+#ifdef ASTAR_HAS_AVX2_DISPATCH
+        constexpr auto lanes = landmark_lanes<_Distance>;
+        if constexpr (lanes > 1)
+            if (cpu_has_avx2() && from_count % lanes == 0 && to_count % lanes == 0)
+                return landmark_bound_avx2(target, node, from_count, to_offset, to_count);
+#endif
+
+        return landmark_bound_scalar(target, node, from_count, to_offset, to_count);
+    }
+} // namespace stdext::astar::detail
@@ -0,0 +1,234 @@
+/// A* Work-Stealing Thread Pool
+/// Copyright (c) Flaviu Cibu. All rights reserved.
+/// Created 15-oct-2026
+#pragma once
+#include "astar_algo.hpp"
+#ifndef PCH
+    #include <algorithm>
+    #include <atomic>
+    #include <condition_variable>
+    #include <cstddef>
+    #include <deque>
+    #include <exception>
+    #include <functional>
+    #include <mutex>
+    #include <thread>
+    #include <utility>
+    #include <vector>
+#endif
+
+namespace stdext::astar
+{
+    /// @brief Fixed size thread pool with a task queue per worker. The submitted tasks are spread over the queues;
+    /// a worker runs the newest task of its own queue and, when it runs out of work, steals the oldest task of the
+    /// other queues, so uneven tasks are balanced without a shared queue all the workers contend on.
+    /// @note A task gets the index of the worker running it, in [0, @ref size), which addresses per worker state.
+    class work_stealing_pool
+    {
+    public:
+        using task_type = std::function<void(std::size_t worker)>;
+
+        /// Starts the workers.
+        /// @param[in] thread_count Number of workers; 0 uses one per hardware thread.
+        explicit work_stealing_pool(const std::size_t thread_count = 0):
+            queues_(thread_count != 0 ? thread_count : std::max<std::size_t>(std::thread::hardware_concurrency(), 1))
+        {
+            threads_.reserve(queues_.size());
+            for (std::size_t worker = 0; worker != queues_.size(); ++worker)
+                threads_.emplace_back([this, worker] { run(worker); });
+        }
+
+        work_stealing_pool(const work_stealing_pool&) = delete;
+        work_stealing_pool& operator=(const work_stealing_pool&) = delete;
+
+        /// Stops the workers after the queued tasks are done.
+        ~work_stealing_pool()
+        {
+            {
+                std::lock_guard lock(mutex_);
+                stopping_ = true;
+            }
+
+            work_available_.notify_all();
+            for (auto& thread: threads_)
+                thread.join();
+        }
+
+        /// Gets the number of workers.
+        std::size_t size() const noexcept { return queues_.size(); }
+
+        /// Queues the task on the next worker queue (round-robin).
+        void submit(task_type task)
+        {
+            auto& queue = queues_[next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size()];
+            unfinished_.fetch_add(1);
+            {
+                std::lock_guard lock(queue.mutex);
+                queue.tasks.push_back(std::move(task));
+            }
+
+            {
+                std::lock_guard lock(mutex_);
+                queued_.fetch_add(1);
+            }
+
+            work_available_.notify_one();
+        }
+
+        /// Waits until all the submitted tasks are done.
+        /// @throw Rethrows the first exception thrown by a task since the last wait.
+        void wait()
+        {
+            std::unique_lock lock(mutex_);
+            all_done_.wait(lock, [this] { return unfinished_.load() == 0; });
+            if (exception_)
+                std::rethrow_exception(std::exchange(exception_, {}));
+        }
+
+    private:
+        struct alignas(64) task_queue
+        {
+            std::mutex mutex;
+            std::deque<task_type> tasks;
+        };
+
+        /// Takes the newest task of the worker queue or steals the oldest task of another queue.
+        bool take(const std::size_t worker, task_type& task)
+        {
+            for (std::size_t i = 0; i != queues_.size(); ++i)
+            {
+                auto& queue = queues_[(worker + i) % queues_.size()];
+                std::lock_guard lock(queue.mutex);
+                if (queue.tasks.empty())
+                    continue;
+
+                if (i == 0)
+                {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                else
+                {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+
+                return true;
+            }
+
+            return false;
+        }
+
+        /// Runs the tasks, sleeping only when all the queues are empty. The queue mutexes are the only locks taken
+        /// while there is work.
+        void run(const std::size_t worker)
+        {
+            task_type task;
+            for (;;)
+            {
+                if (take(worker, task))
+                {
+                    queued_.fetch_sub(1);
+                    try
+                    {
+                        task(worker);
+                    }
+                    catch (...)
+                    {
+                        std::lock_guard lock(mutex_);
+                        if (!exception_)
+                            exception_ = std::current_exception();
+                    }
+
+                    task = nullptr;
+                    if (unfinished_.fetch_sub(1) == 1)
+                    {
+                        std::lock_guard lock(mutex_);
+                        all_done_.notify_all();
+                    }
+
+                    continue;
+                }
+
+                std::unique_lock lock(mutex_);
+                // the counter may be transiently off while a task is being queued, which only causes a retry
+                work_available_.wait(lock, [this] { return queued_.load() != 0 || stopping_; });
+                if (stopping_ && queued_.load() == 0)
+                    return;
+            }
+        }
+
+        std::vector<task_queue> queues_;
+        std::vector<std::thread> threads_;
+        std::atomic<std::size_t> next_queue_ {};
+        std::mutex mutex_;
+        std::condition_variable work_available_;
+        std::condition_variable all_done_;
+        std::atomic<std::size_t> queued_ {};
+        std::atomic<std::size_t> unfinished_ {};
+        std::exception_ptr exception_;
+        bool stopping_ {};
+    };
+
+    /// @brief Executor running the parallel loops on a @ref work_stealing_pool, e.g. the neighbor generation of
+    /// @ref algo in parallel mode. The loop is split in one chunk per worker at most; the calling thread runs the
+    /// last chunk itself and waits for the others.
+    /// @note The calling thread must not be a worker of the same pool, which could leave no worker for the chunks.
+    class pool_executor: public executor
+    {
+    public:
+        /// @param[in] pool Thread pool; it has to outlive the executor
+        /// @param[in] grain Minimum number of indexes of a chunk
+        explicit pool_executor(work_stealing_pool& pool, const std::size_t grain = 1) noexcept: pool_(&pool), grain_(std::max<std::size_t>(grain, 1)) {}
+
+        /// @throw Rethrows the first exception thrown by the function.
+        void parallel_for(const std::size_t count, void (*const function)(void* context, std::size_t index), void* const context) override
+        {
+            const std::size_t chunks = std::min((count + grain_ - 1) / grain_, pool_->size() + 1);
+            if (chunks <= 1)
+            {
+                for (std::size_t i = 0; i != count; ++i)
+                    function(context, i);
+
+                return;
+            }
+
+            std::mutex mutex;
+            std::condition_variable all_done;
+            std::size_t pending = chunks - 1;
+            std::exception_ptr exception;
+            const auto run = [&](const std::size_t chunk) {
+                try
+                {
+                    for (auto i = count * chunk / chunks; i != count * (chunk + 1) / chunks; ++i)
+                        function(context, i);
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(mutex);
+                    if (!exception)
+                        exception = std::current_exception();
+                }
+            };
+
+            for (std::size_t chunk = 0; chunk + 1 != chunks; ++chunk)
+                pool_->submit([&, chunk](std::size_t) {
+                    run(chunk);
+                    // notified under the lock, since the waiter destroys the state as soon as it wakes up
+                    std::lock_guard lock(mutex);
+                    if (--pending == 0)
+                        all_done.notify_one();
+                });
+
+            run(chunks - 1);
+            std::unique_lock lock(mutex);
+            all_done.wait(lock, [&] { return pending == 0; });
+            if (exception)
+                std::rethrow_exception(exception);
+        }
+
+    private:
+        work_stealing_pool* pool_;
+        std::size_t grain_;
+    };
+} // namespace stdext::astar
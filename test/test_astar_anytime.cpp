@@ -0,0 +1,154 @@
+#include "astar_anytime.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using table = dense_node_table<int>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+    using ara_algo = anytime_algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier>;
+
+    /// Builds a grid of random cell costs with a few walls.
+    vector<string> make_terrain(const int size)
+    {
+        vector<string> rows(size, string(size, '1'));
+        unsigned seed = 12345;
+        for (auto& row: rows)
+            for (auto& cell: row)
+            {
+                seed = seed * 1103515245 + 12345;
+                const unsigned value = seed >> 16 & 0x7fff;
+                cell = value % 11 == 0 ? '#' : static_cast<char>('1' + value % 9);
+            }
+
+        rows.front().front() = rows.back().back() = '1';
+        return rows;
+    }
+
+    int solve(grid& g, cell_node& start, cell_node& target, const double epsilon, size_t& expanded)
+    {
+        start.set_general_score(0);
+        dense_algo as_algo(start, target, {target.id()}, enumerator(g), {});
+        as_algo.set_epsilon(epsilon);
+        as_algo.reset(start, target);
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        expanded = as_algo.statistics().expanded_nodes;
+        return as_algo.node().general_score();
+    }
+
+    /// Gets the cost of the path, checking that its cells are adjacent.
+    int path_cost(grid& g, const int width, const vector<uint32_t>& path)
+    {
+        int cost = 0;
+        for (size_t i = 1; i != path.size(); ++i)
+        {
+            const int from = static_cast<int>(path[i - 1]), to = static_cast<int>(path[i]);
+            assert(abs(from % width - to % width) + abs(from / width - to / width) == 1);
+            cost += g.at(from % width, from / width).distance_to(g.at(to % width, to / width));
+        }
+
+        return cost;
+    }
+
+    void test_weighted()
+    {
+        const auto terrain = make_terrain(40);
+        vector<const char*> rows;
+        for (const auto& row: terrain)
+            rows.push_back(row.c_str());
+
+        grid g(rows);
+        size_t optimal_expanded = 0, weighted_expanded = 0;
+        const int optimal = solve(g, g.at(0, 0), g.at(39, 39), 1, optimal_expanded);
+        const int weighted = solve(g, g.at(0, 0), g.at(39, 39), 3, weighted_expanded);
+        assert(optimal <= weighted && weighted <= 3 * optimal);
+        assert(weighted_expanded < optimal_expanded);
+        cout << "weighted A*: optimal=" << optimal << " expanded=" << optimal_expanded << " epsilon 3 cost=" << weighted
+             << " expanded=" << weighted_expanded << '\n';
+    }
+
+    void test_anytime()
+    {
+        const auto terrain = make_terrain(40);
+        vector<const char*> rows;
+        for (const auto& row: terrain)
+            rows.push_back(row.c_str());
+
+        grid g(rows);
+        cell_node& start = g.at(0, 0);
+        cell_node& target = g.at(39, 39);
+        size_t optimal_expanded = 0;
+        [[maybe_unused]] const int optimal = solve(g, start, target, 1, optimal_expanded);
+
+        start.set_general_score(0);
+        ara_algo as_algo(start, target, {target.id()}, enumerator(g), 3, 0.5);
+        [[maybe_unused]] const bool found = as_algo.search();
+        assert(found);
+        const size_t first_expanded = as_algo.statistics().expanded_nodes;
+        const int first_cost = as_algo.cost();
+        int last_cost = first_cost;
+        double last_bound = as_algo.suboptimality_bound();
+        assert(last_bound <= 3 && last_cost <= last_bound * optimal + 1e-9);
+        assert(path_cost(g, 40, as_algo.solution().path(target)) <= last_cost);
+        cout << "ARA*: epsilon=" << as_algo.epsilon() << " cost=" << last_cost << " bound=" << last_bound << " expanded=" << first_expanded << '\n';
+
+        size_t searches = 1;
+        while (as_algo.improve())
+        {
+            [[maybe_unused]] const bool improved = as_algo.search();
+            assert(improved);
+            ++searches;
+            assert(as_algo.cost() <= last_cost && as_algo.suboptimality_bound() <= last_bound);
+            last_cost = as_algo.cost();
+            last_bound = as_algo.suboptimality_bound();
+            assert(last_cost <= last_bound * optimal + 1e-9);
+            assert(path_cost(g, 40, as_algo.solution().path(target)) <= last_cost);
+            cout << "ARA*: epsilon=" << as_algo.epsilon() << " cost=" << last_cost << " bound=" << last_bound
+                 << " expanded=" << as_algo.statistics().expanded_nodes << '\n';
+        }
+
+        assert(searches > 1 && last_bound == 1 && last_cost == optimal);
+        assert(path_cost(g, 40, as_algo.solution().path(target)) == optimal);
+        assert(first_expanded < optimal_expanded);
+
+        // a new series reuses the instance
+        start.set_general_score(0);
+        as_algo.reset(start, target);
+        assert(as_algo.epsilon() == 3);
+        [[maybe_unused]] const bool found_again = as_algo.search();
+        assert(found_again && as_algo.statistics().expanded_nodes == first_expanded);
+
+        // the time budget drives the whole series
+        start.set_general_score(0);
+        as_algo.reset(start, target);
+        [[maybe_unused]] const bool can_continue = as_algo.run_for(chrono::seconds(10));
+        assert(!can_continue);
+        assert(as_algo.suboptimality_bound() == 1 && as_algo.cost() == optimal);
+
+        start.set_general_score(0);
+        as_algo.reset(start, target);
+        [[maybe_unused]] const bool stepped = as_algo.run_steps(first_expanded + 1);
+        assert(stepped && as_algo.epsilon() == 2.5 && as_algo.cost() == first_cost);
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_weighted();
+    test_anytime();
+
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include "astar_arena.hpp"
+#include "astar_node_table.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <memory_resource>
+#include <queue>
+#include <set>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    /// Memory resource counting the allocations forwarded to its upstream resource.
+    class counting_resource: public pmr::memory_resource
+    {
+    public:
+        counting_resource(pmr::memory_resource* upstream = pmr::get_default_resource()): upstream_(upstream) {}
+
+        size_t allocations = 0;
+
+    private:
+        void* do_allocate(const size_t bytes, const size_t alignment) override
+        {
+            ++allocations;
+            return upstream_->allocate(bytes, alignment);
+        }
+
+        void do_deallocate(void* p, const size_t bytes, const size_t alignment) override { upstream_->deallocate(p, bytes, alignment); }
+
+        bool do_is_equal(const memory_resource& other) const noexcept override { return this == &other; }
+
+        pmr::memory_resource* upstream_;
+    };
+
+    using queue = priority_queue<cell_node, pmr::vector<cell_node>, greater<cell_node>>;
+    using tree_algo = astar::algo<cell_node, queue, enumerator, pmr::set<int>, solution_verifier, pmr::map<int, int>>;
+    using table = dense_node_table<int>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+
+    template <typename _Algo>
+    int solve(grid& g, pmr::memory_resource* resource)
+    {
+        _Algo as_algo(g.at(0, 0), g.at(4, 4), {44}, enumerator(g), {}, resource);
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        return as_algo.node().general_score();
+    }
+
+    template <typename _Algo>
+    void test_arena(const char* name)
+    {
+        grid g(weighted_maze);
+        counting_resource upstream;
+        search_arena arena(search_arena::default_capacity, &upstream);
+        for (int query = 0; query != 3; ++query)
+        {
+            counting_resource counter(arena.resource());
+            const int cost = solve<_Algo>(g, &counter);
+            arena.release();
+            assert(cost == 28);
+            assert(counter.allocations > 0);
+            if (query == 0)
+                cout << name << ": cost=" << cost << " arena allocations=" << counter.allocations;
+        }
+
+        assert(upstream.allocations == 0);
+        cout << " upstream allocations=" << upstream.allocations << '\n';
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_arena<tree_algo>("tree");
+    test_arena<dense_algo>("dense");
+    return 0;
+}
@@ -0,0 +1,137 @@
+#include "astar_batch.hpp"
+#include "astar_csr_graph.hpp"
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using graph = csr_graph<int>;
+    using node = csr_node<int>;
+    using solver = batch_solver<csr_algo<int>>;
+
+    /// Builds a 4-connected grid graph of pseudo-random edge weights in [1, 9].
+    graph make_graph(const int width, const int height)
+    {
+        vector<graph::edge> edges;
+        vector<csr_point> coordinates;
+        unsigned seed = 2024;
+        for (int y = 0; y != height; ++y)
+            for (int x = 0; x != width; ++x)
+            {
+                coordinates.push_back({static_cast<float>(x), static_cast<float>(y)});
+                const auto from = static_cast<uint32_t>(y * width + x);
+                const int dx[] = {1, 0, -1, 0}, dy[] = {0, 1, 0, -1};
+                for (int direction = 0; direction != 4; ++direction)
+                    if (x + dx[direction] >= 0 && x + dx[direction] < width && y + dy[direction] >= 0 && y + dy[direction] < height)
+                    {
+                        seed = seed * 1103515245 + 12345;
+                        const auto to = static_cast<uint32_t>((y + dy[direction]) * width + x + dx[direction]);
+                        edges.push_back({from, to, static_cast<int>(1 + (seed >> 16) % 9)});
+                    }
+            }
+
+        graph result(coordinates.size(), edges);
+        result.set_coordinates(coordinates);
+        return result;
+    }
+
+    void test_pool()
+    {
+        work_stealing_pool pool(4);
+        assert(pool.size() == 4);
+        atomic<int> sum = 0;
+        vector<atomic<int>> runs(pool.size());
+        for (int i = 1; i <= 1000; ++i)
+            pool.submit([&, i](const size_t worker) {
+                sum += i;
+                ++runs[worker];
+            });
+
+        pool.wait();
+        assert(sum == 500500);
+
+        pool.submit([](size_t) { throw runtime_error("task failed"); });
+        pool.submit([&](size_t) { ++sum; });
+        [[maybe_unused]] bool thrown = false;
+        try
+        {
+            pool.wait();
+        }
+        catch (const runtime_error&)
+        {
+            thrown = true;
+        }
+
+        assert(thrown && sum == 500501);
+        pool.wait();
+    }
+
+    void test_batch()
+    {
+        const graph owned = make_graph(60, 60);
+        const auto view = owned.view();
+        vector<solver::query> queries;
+        unsigned seed = 7;
+        for (int i = 0; i != 400; ++i)
+        {
+            seed = seed * 1103515245 + 12345;
+            const auto start = (seed >> 8) % owned.node_count();
+            seed = seed * 1103515245 + 12345;
+            const auto target = (seed >> 8) % owned.node_count();
+            queries.push_back({node(view, static_cast<uint32_t>(start)), node(view, static_cast<uint32_t>(target))});
+        }
+
+        const auto factory = [&view](const node& start, const node& target, pmr::memory_resource* const resource) {
+            return csr_algo<int>(start, target, {target}, csr_enumerator<node>(view), {}, resource);
+        };
+
+        vector<int> expected;
+        const auto sequential_start = chrono::steady_clock::now();
+        for (const auto& query: queries)
+        {
+            auto as_algo = factory(query.start_node, query.target_node, pmr::get_default_resource());
+            while (as_algo())
+            {
+            }
+
+            assert(as_algo.has_solution());
+            expected.push_back(as_algo.node().general_score());
+        }
+
+        const auto sequential = chrono::steady_clock::now() - sequential_start;
+        work_stealing_pool pool(4);
+        solver batch(pool, factory);
+        const auto parallel_start = chrono::steady_clock::now();
+        const auto results = batch.solve(queries);
+        const auto parallel = chrono::steady_clock::now() - parallel_start;
+        for (size_t i = 0; i != queries.size(); ++i)
+            assert(results[i].found && results[i].cost == expected[i] && results[i].expanded_nodes > 0);
+
+        // the workers reuse their algorithm instances
+        vector<size_t> path_lengths(queries.size());
+        batch.solve(
+            queries, [&](const size_t index, csr_algo<int>& as_algo) { path_lengths[index] = as_algo.solution().path(queries[index].target_node).size(); }, 7);
+        for (size_t i = 0; i != queries.size(); ++i)
+            assert(path_lengths[i] >= 1 && (path_lengths[i] == 1) == (queries[i].start_node.id() == queries[i].target_node.id()));
+
+        cout << "queries=" << queries.size() << " sequential=" << chrono::duration_cast<chrono::milliseconds>(sequential).count()
+             << "ms batch of 4 workers=" << chrono::duration_cast<chrono::milliseconds>(parallel).count() << "ms\n";
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_pool();
+    test_batch();
+
+    return 0;
+}
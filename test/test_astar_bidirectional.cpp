@@ -0,0 +1,88 @@
+#include "astar_node_table.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using table = dense_node_table<int>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+
+    template <typename _PriorityQueue>
+    using grid_bidirectional_algo = astar::bidirectional_algo<cell_node, _PriorityQueue, enumerator, enumerator, table>;
+
+    /// Gets the cost of the path, checking that it is contiguous.
+    int path_cost(grid& g, const int width, const vector<table::index_type>& path)
+    {
+        int cost = 0;
+        for (size_t i = 1; i < path.size(); ++i)
+        {
+            const int x0 = static_cast<int>(path[i - 1]) % width, y0 = static_cast<int>(path[i - 1]) / width;
+            const int x1 = static_cast<int>(path[i]) % width, y1 = static_cast<int>(path[i]) / width;
+            assert(abs(x1 - x0) + abs(y1 - y0) == 1);
+            cost += g.at(x0, y0).distance_to(g.at(x1, y1));
+        }
+
+        return cost;
+    }
+
+    template <typename _PriorityQueue>
+    void test_queries(const vector<const char*>& rows, const pair<int, int> (&queries)[4][2])
+    {
+        grid g(rows);
+        for (const auto& query: queries)
+        {
+            cell_node& start = g.at(query[0].first, query[0].second);
+            cell_node& target = g.at(query[1].first, query[1].second);
+            start.set_general_score(0);
+            dense_algo forward(start, target, {target.id()}, enumerator(g), {});
+            while (forward())
+            {
+            }
+
+            grid_bidirectional_algo<_PriorityQueue> bidirectional(start, target, enumerator(g), enumerator(g));
+            while (bidirectional())
+            {
+            }
+
+            assert(forward.has_solution() && bidirectional.has_solution());
+            assert(bidirectional.cost() == forward.node().general_score());
+
+            const auto path = bidirectional.solution().path(target);
+            assert(path.front() == static_cast<table::index_type>(start.id()));
+            assert(path.back() == static_cast<table::index_type>(target.id()));
+            assert(path_cost(g, static_cast<int>(string(rows.front()).size()), path) == bidirectional.cost());
+            cout << "cost=" << bidirectional.cost() << " expanded: forward=" << forward.statistics().expanded_nodes
+                 << " bidirectional=" << bidirectional.statistics().expanded_nodes << '\n';
+        }
+    }
+
+    void test_no_path()
+    {
+        const vector<const char*> rows = {"...#.", "...#.", "####."};
+        grid g(rows);
+        grid_bidirectional_algo<dense_heap<cell_node>> bidirectional(g.at(0, 0), g.at(4, 0), enumerator(g), enumerator(g));
+        while (bidirectional())
+        {
+        }
+
+        assert(!bidirectional.has_solution());
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    const pair<int, int> queries[4][2] = {{{0, 0}, {4, 4}}, {{9, 0}, {0, 9}}, {{4, 4}, {9, 8}}, {{0, 0}, {0, 0}}};
+    test_queries<astar::dense_heap<cell_node>>(maze, queries);
+    test_queries<astar::dense_heap<cell_node>>(weighted_maze, queries);
+    test_queries<astar::default_priority_queue<cell_node>>(weighted_maze, queries);
+    test_no_path();
+    return 0;
+}
@@ -0,0 +1,138 @@
+#include "astar_csr_file.hpp"
+#include <cassert>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using graph = csr_graph<float>;
+
+    /// Builds a ring of nodes with chords, placed on a circle.
+    graph make_graph(const uint32_t node_count)
+    {
+        vector<graph::edge> edges;
+        vector<csr_point> coordinates;
+        for (uint32_t id = 0; id != node_count; ++id)
+        {
+            edges.push_back({id, (id + 1) % node_count, 1.f});
+            edges.push_back({(id + 1) % node_count, id, 1.f});
+            if (id % 5 == 0)
+                edges.push_back({id, (id + node_count / 2) % node_count, 3.f});
+
+            coordinates.push_back({static_cast<float>(id % 7), static_cast<float>(id / 7)});
+        }
+
+        graph result(node_count, edges);
+        result.set_coordinates(coordinates);
+        return result;
+    }
+
+    float solve(const csr_view<float>& view, const uint32_t from, const uint32_t to)
+    {
+        const csr_node<float> target(view, to, 0.1f);
+        csr_algo<float> as_algo(csr_node<float>(view, from, 0.1f), target, target, csr_enumerator<csr_node<float>>(view, target), {});
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        return as_algo.node().general_score();
+    }
+
+    void test_round_trip(const string& path)
+    {
+        const graph owned = make_graph(60);
+        write_csr_file(path, owned.view());
+
+        mapped_csr_graph<float> mapped(path);
+        const auto& view = mapped.view();
+        assert(view.node_count() == owned.node_count() && view.edge_count() == owned.edge_count() && view.has_coordinates());
+        assert(mapped.header().offsets_offset % csr_file_header::alignment == 0);
+        for (uint32_t id = 0; id != view.node_count(); ++id)
+        {
+            const auto expected = owned.view().targets(id);
+            const auto actual = view.targets(id);
+            assert(equal(expected.begin(), expected.end(), actual.begin(), actual.end()));
+        }
+
+        [[maybe_unused]] const auto owned_view = owned.view();
+        for (const auto& [from, to]: {pair {0u, 30u}, pair {7u, 52u}, pair {59u, 1u}})
+        {
+            const float cost = solve(view, from, to);
+            assert(cost == solve(owned_view, from, to));
+            cout << "cost=" << cost << '\n';
+        }
+
+        mapped_csr_graph<float> moved(std::move(mapped));
+        assert(moved.view().node_count() == 60);
+    }
+
+    void test_invalid(const string& path)
+    {
+        write_csr_file(path, make_graph(10).view());
+        [[maybe_unused]] bool thrown = false;
+        try
+        {
+            mapped_csr_graph<int> mismatched(path);
+        }
+        catch (const runtime_error&)
+        {
+            thrown = true;
+        }
+
+        assert(thrown);
+
+        ofstream(path, ios::binary | ios::trunc) << "not a graph";
+        thrown = false;
+        try
+        {
+            mapped_csr_graph<float> invalid(path);
+        }
+        catch (const runtime_error&)
+        {
+            thrown = true;
+        }
+
+        assert(thrown);
+
+        // an interior offset beyond the edges
+        write_csr_file(path, make_graph(10).view());
+        const uint64_t offsets_offset = mapped_csr_graph<float>(path).header().offsets_offset;
+        {
+            fstream file(path, ios::binary | ios::in | ios::out);
+            const uint32_t offset = 1000;
+            file.seekp(static_cast<streamoff>(offsets_offset + 3 * sizeof(uint32_t)));
+            file.write(reinterpret_cast<const char*>(&offset), sizeof(offset));
+        }
+
+        thrown = false;
+        try
+        {
+            mapped_csr_graph<float> corrupted(path);
+        }
+        catch (const runtime_error&)
+        {
+            thrown = true;
+        }
+
+        assert(thrown);
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    const string path = "test_astar_csr_file.bin";
+    test_round_trip(path);
+    test_invalid(path);
+    remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,121 @@
+#include "astar_csr_graph.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using table = dense_node_table<int>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+    using graph = csr_graph<int>;
+
+    /// CSR enumerator hiding the batch protocol, so the algorithm relaxes the neighbors one by one.
+    class streaming_enumerator
+    {
+    public:
+        streaming_enumerator(const csr_view<int>& graph): enumerator_(graph) {}
+
+        operator bool() const noexcept { return static_cast<bool>(enumerator_); }
+        void operator()(const csr_node<int>& node) noexcept { enumerator_(node); }
+        void operator++() noexcept { ++enumerator_; }
+        csr_node<int>& operator*() noexcept { return *enumerator_; }
+        int cost() const noexcept { return enumerator_.cost(); }
+
+    private:
+        csr_enumerator<csr_node<int>> enumerator_;
+    };
+
+    using streaming_algo = astar::algo<csr_node<int>, dense_heap<csr_node<int>>, streaming_enumerator, table, target_id_verifier, table>;
+    static_assert(csr_algo<int>::batch_mode && !streaming_algo::batch_mode);
+
+    /// Converts the grid to a CSR graph, the edge weight being the cost of entering the cell.
+    graph make_graph(const vector<const char*>& rows)
+    {
+        grid g(rows);
+        const int width = static_cast<int>(string(rows.front()).size());
+        vector<graph::edge> edges;
+        vector<csr_point> coordinates;
+        enumerator neighbors(g);
+        // adds the edges in reverse order to check the grouping by source node
+        for (int id = static_cast<int>(g.size()) - 1; id >= 0; --id)
+        {
+            cell_node& node = g.at(id % width, id / width);
+            for (neighbors(node); neighbors; ++neighbors)
+                edges.push_back({static_cast<uint32_t>(id), static_cast<uint32_t>((*neighbors).id()), node.distance_to(*neighbors)});
+        }
+
+        for (int id = 0; id != static_cast<int>(g.size()); ++id)
+            coordinates.push_back({static_cast<float>(id % width), static_cast<float>(id / width)});
+
+        graph result(g.size(), edges);
+        result.set_coordinates(coordinates);
+        return result;
+    }
+
+    void test_layout()
+    {
+        const vector<graph::edge> edges = {{2, 0, 5}, {0, 1, 1}, {0, 2, 4}, {1, 2, 2}};
+        const graph owned(3, edges);
+        const auto view = owned.view();
+        assert(view.node_count() == 3 && view.edge_count() == 4 && !view.has_coordinates());
+        assert(view.targets(0).size() == 2 && view.targets(0)[0] == 1 && view.weights(0)[1] == 4);
+        assert(view.targets(2).size() == 1 && view.targets(2)[0] == 0);
+
+        csr_enumerator<csr_node<int>> neighbors(view);
+        int weights = 0;
+        for (neighbors(csr_node<int>(view, 0)); neighbors; ++neighbors)
+            weights += neighbors.cost();
+
+        assert(weights == 5);
+    }
+
+    void test_queries(const vector<const char*>& rows)
+    {
+        const graph owned = make_graph(rows);
+        const auto view = owned.view();
+        grid g(rows);
+        const pair<int, int> queries[][2] = {{{0, 0}, {4, 4}}, {{9, 0}, {0, 9}}, {{4, 4}, {9, 8}}};
+        for (const auto& query: queries)
+        {
+            cell_node& start = g.at(query[0].first, query[0].second);
+            cell_node& target = g.at(query[1].first, query[1].second);
+            start.set_general_score(0);
+            dense_algo reference(start, target, {target.id()}, enumerator(g), {});
+            while (reference())
+            {
+            }
+
+            const csr_node<int> csr_start(view, start.id()), csr_target(view, target.id());
+            csr_algo<int> as_algo(csr_start, csr_target, csr_target, csr_enumerator<csr_node<int>>(view), {});
+            while (as_algo())
+            {
+            }
+
+            streaming_algo streaming(csr_start, csr_target, csr_target, streaming_enumerator(view), {});
+            while (streaming())
+            {
+            }
+
+            assert(as_algo.has_solution() && as_algo.node().general_score() == reference.node().general_score());
+            assert(as_algo.solution().path(csr_target) == reference.solution().path(target));
+            assert(streaming.solution().path(csr_target) == as_algo.solution().path(csr_target));
+            assert(streaming.statistics().expanded_nodes == as_algo.statistics().expanded_nodes);
+            cout << "cost=" << as_algo.node().general_score() << " expanded=" << as_algo.statistics().expanded_nodes << '\n';
+        }
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_layout();
+    test_queries(maze);
+    test_queries(weighted_maze);
+    return 0;
+}
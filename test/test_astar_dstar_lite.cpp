@@ -0,0 +1,118 @@
+#include "astar_dstar_lite.hpp"
+#include "astar_node_table.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using table = dense_node_table<int>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+    using grid_dstar_lite = astar::dstar_lite<cell_node, enumerator>;
+
+    /// Grid enumerator giving all the edges the same stored weight.
+    class weighted_grid_enumerator: public enumerator
+    {
+    public:
+        using enumerator::enumerator;
+
+        int cost() const noexcept { return 10; }
+    };
+
+    /// Solves the query from scratch.
+    int solve(const vector<string>& rows, const pair<int, int> from, const pair<int, int> to)
+    {
+        vector<const char*> pointers;
+        for (const auto& row: rows)
+            pointers.push_back(row.c_str());
+
+        grid g(pointers);
+        cell_node& target = g.at(to.first, to.second);
+        dense_algo as_algo(g.at(from.first, from.second), target, {target.id()}, enumerator(g), {});
+        while (as_algo())
+        {
+        }
+
+        return as_algo.has_solution() ? as_algo.node().general_score() : grid_dstar_lite::infinity;
+    }
+
+    /// Blocks the cell by making all the edges entering it impassable.
+    void block(grid& g, grid_dstar_lite& planner, vector<string>& rows, const int x, const int y)
+    {
+        enumerator neighbors(g);
+        for (neighbors(g.at(x, y)); neighbors; ++neighbors)
+            planner.update_edge_cost(*neighbors, g.at(x, y), grid_dstar_lite::infinity);
+
+        rows[y][x] = '#';
+    }
+
+    void test_replanning()
+    {
+        vector<string> rows(weighted_maze.begin(), weighted_maze.end());
+        grid g(weighted_maze);
+        pair<int, int> start {0, 0};
+        const pair<int, int> target {9, 8};
+        grid_dstar_lite planner(g.at(start.first, start.second), g.at(target.first, target.second), enumerator(g), enumerator(g));
+        [[maybe_unused]] const bool found = planner.compute_shortest_path();
+        assert(found && planner.cost() == solve(rows, start, target));
+        const auto initial_expanded = planner.statistics().expanded_nodes;
+
+        // Moves along the path and blocks cells ahead of the agent.
+        const pair<int, int> blocked[] = {{2, 5}, {6, 8}, {9, 4}};
+        for (const auto& cell: blocked)
+        {
+            const auto path = planner.path();
+            assert(path.size() > 2);
+            start = {static_cast<int>(path[1]) % 10, static_cast<int>(path[1]) / 10};
+            planner.set_start(g.at(start.first, start.second));
+            block(g, planner, rows, cell.first, cell.second);
+
+            const auto expanded = planner.statistics().expanded_nodes;
+            planner.compute_shortest_path();
+            assert(planner.cost() == solve(rows, start, target));
+            cout << "cost=" << planner.cost() << " replanning expanded=" << planner.statistics().expanded_nodes - expanded
+                 << " initial expanded=" << initial_expanded << '\n';
+        }
+    }
+
+    void test_unreachable()
+    {
+        const vector<const char*> map = {"..#..", "..#..", "....."};
+        vector<string> rows(map.begin(), map.end());
+        grid g(map);
+        grid_dstar_lite planner(g.at(0, 0), g.at(4, 0), enumerator(g), enumerator(g));
+        [[maybe_unused]] const bool found = planner.compute_shortest_path();
+        assert(found && planner.cost() == 8 && planner.path().size() == 9);
+        block(g, planner, rows, 2, 2);
+        [[maybe_unused]] const bool found_blocked = planner.compute_shortest_path();
+        assert(!found_blocked && planner.path().empty());
+    }
+
+    /// Checks that the edge costs given by the planner are the weights of the enumerator it searches with.
+    void test_weighted_edges()
+    {
+        grid g(maze);
+        astar::dstar_lite<cell_node, weighted_grid_enumerator> planner(g.at(0, 0), g.at(9, 8), weighted_grid_enumerator(g), weighted_grid_enumerator(g));
+        [[maybe_unused]] const bool found = planner.compute_shortest_path();
+        assert(found && planner.cost() == 10 * solve(vector<string>(maze.begin(), maze.end()), {0, 0}, {9, 8}));
+        assert(planner.edge_cost(g.at(0, 0), g.at(1, 0)) == 10);
+        assert(planner.edge_cost(g.at(0, 0), g.at(5, 5)) == grid_dstar_lite::infinity);
+        planner.update_edge_cost(g.at(0, 0), g.at(1, 0), 3);
+        assert(planner.edge_cost(g.at(0, 0), g.at(1, 0)) == 3);
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_replanning();
+    test_unreachable();
+    test_weighted_edges();
+    return 0;
+}
@@ -0,0 +1,122 @@
+#include "astar_generator.hpp"
+#include "astar_node_table.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using table = dense_node_table<int>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+
+    generator<int> count_to(const int count)
+    {
+        for (int i = 1; i <= count; ++i)
+            co_yield i;
+    }
+
+    generator<int> fail_after(const int count)
+    {
+        for (int i = 1; i <= count; ++i)
+            co_yield i;
+
+        throw runtime_error("failed");
+    }
+
+    void test_generator()
+    {
+        vector<int> values;
+        for (const int value: count_to(4))
+            values.push_back(value);
+
+        assert((values == vector<int> {1, 2, 3, 4}));
+
+        auto numbers = count_to(2);
+        [[maybe_unused]] bool advanced = numbers.next();
+        assert(advanced && numbers.value() == 1);
+        advanced = numbers.next();
+        assert(advanced && numbers.value() == 2);
+        advanced = numbers.next();
+        assert(!advanced && numbers.done());
+        advanced = numbers.next();
+        assert(!advanced);
+
+        auto failing = fail_after(1);
+        advanced = failing.next();
+        assert(advanced && failing.value() == 1);
+        [[maybe_unused]] bool thrown = false;
+        try
+        {
+            failing.next();
+        }
+        catch (const runtime_error&)
+        {
+            thrown = true;
+        }
+
+        assert(thrown && failing.done());
+    }
+
+    /// Interleaves several searches, advancing their generators in turn, and compares them with the step-wise loop.
+    void test_interleaved()
+    {
+        grid g(weighted_maze);
+        const pair<int, int> queries[][2] = {{{0, 0}, {9, 8}}, {{9, 0}, {0, 9}}, {{4, 4}, {9, 8}}};
+        vector<dense_algo> searches;
+        vector<generator<cell_node>> generators;
+        for (const auto& query: queries)
+        {
+            cell_node& start = g.at(query[0].first, query[0].second);
+            cell_node& target = g.at(query[1].first, query[1].second);
+            start.set_general_score(0);
+            searches.emplace_back(start, target, solution_verifier {target.id()}, enumerator(g), no_beam_search {});
+        }
+
+        for (auto& search: searches)
+            generators.push_back(expansions(search, 4));
+
+        vector<size_t> yields(size(queries));
+        for (bool running = true; running;)
+        {
+            running = false;
+            for (size_t i = 0; i != generators.size(); ++i)
+                if (generators[i].next())
+                {
+                    running = true;
+                    ++yields[i];
+                    assert(&generators[i].value() == &searches[i].node());
+                }
+        }
+
+        for (size_t i = 0; i != size(queries); ++i)
+        {
+            cell_node& start = g.at(queries[i][0].first, queries[i][0].second);
+            cell_node& target = g.at(queries[i][1].first, queries[i][1].second);
+            start.set_general_score(0);
+            dense_algo stepped(start, target, {target.id()}, enumerator(g), {});
+            while (stepped())
+            {
+            }
+
+            const auto expanded = stepped.statistics().expanded_nodes;
+            assert(searches[i].has_solution() && searches[i].node().general_score() == stepped.node().general_score());
+            assert(searches[i].statistics().expanded_nodes == expanded && yields[i] == expanded / 4 + 1);
+            cout << "query " << i << ": cost=" << stepped.node().general_score() << " expanded=" << expanded << " yields=" << yields[i] << '\n';
+        }
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_generator();
+    test_interleaved();
+
+    return 0;
+}
@@ -0,0 +1,209 @@
+#include "astar_hda.hpp"
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <deque>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    const zobrist_table zobrist(9, 9);
+
+    /// State of the 8-puzzle: tiles[position] is the tile at the position, 0 being the blank.
+    class puzzle_node: public base_node<int>
+    {
+    public:
+        using tiles_type = array<uint8_t, 9>;
+
+        puzzle_node(const tiles_type& tiles = {1, 2, 3, 4, 5, 6, 7, 8, 0}): tiles_(tiles), hash_(zobrist.hash(tiles))
+        {
+            for (uint8_t i = 0; i != 9; ++i)
+                if (tiles_[i] == 0)
+                    blank_ = i;
+        }
+
+        const tiles_type& tiles() const noexcept { return tiles_; }
+        uint64_t hash() const noexcept { return hash_; }
+
+        int distance_to(const puzzle_node&) const noexcept { return 1; }
+
+        /// Sum of the Manhattan distances of the tiles to their positions in the target.
+        void set_heuristic_score(int, const puzzle_node& target) noexcept
+        {
+            int score = 0;
+            for (int i = 0; i != 9; ++i)
+                if (tiles_[i] != 0)
+                    for (int j = 0; j != 9; ++j)
+                        if (target.tiles_[j] == tiles_[i])
+                            score += abs(i % 3 - j % 3) + abs(i / 3 - j / 3);
+
+            base_node::set_heuristic_score(score);
+        }
+
+        /// Moves the blank to the given position, updating the hash incrementally.
+        void move_blank(const uint8_t position) noexcept
+        {
+            const auto tile = tiles_[position];
+            hash_ = zobrist.update(zobrist.update(hash_, position, tile, 0), blank_, 0, tile);
+            tiles_[blank_] = tile;
+            tiles_[position] = 0;
+            blank_ = position;
+        }
+
+        uint8_t blank() const noexcept { return blank_; }
+
+        bool operator==(const puzzle_node& other) const noexcept { return tiles_ == other.tiles_; }
+
+    private:
+        tiles_type tiles_;
+        uint64_t hash_;
+        uint8_t blank_ {};
+    };
+
+    struct puzzle_hash
+    {
+        size_t operator()(const puzzle_node& node) const noexcept { return static_cast<size_t>(node.hash()); }
+    };
+
+    class puzzle_enumerator
+    {
+    public:
+        operator bool() const noexcept { return direction_ < 4; }
+
+        void operator()(const puzzle_node& node)
+        {
+            source_ = node;
+            direction_ = -1;
+            ++*this;
+        }
+
+        void operator++()
+        {
+            static constexpr int dx[] = {1, 0, -1, 0};
+            static constexpr int dy[] = {0, 1, 0, -1};
+            const int x = source_.blank() % 3, y = source_.blank() / 3;
+            while (++direction_ < 4 && (x + dx[direction_] < 0 || x + dx[direction_] > 2 || y + dy[direction_] < 0 || y + dy[direction_] > 2))
+            {
+            }
+
+            if (direction_ < 4)
+            {
+                node_ = source_;
+                node_.move_blank(static_cast<uint8_t>((y + dy[direction_]) * 3 + x + dx[direction_]));
+            }
+        }
+
+        puzzle_node& operator*() noexcept { return node_; }
+
+    private:
+        puzzle_node source_, node_;
+        int direction_ {4};
+    };
+
+    struct puzzle_verifier
+    {
+        bool operator()(const puzzle_node& node) const noexcept { return node == puzzle_node(); }
+    };
+
+    using puzzle_algo = hda_algo<puzzle_node, puzzle_enumerator, puzzle_verifier, puzzle_hash>;
+
+    /// Scrambles the solved puzzle with a random walk of the blank.
+    puzzle_node scramble(unsigned seed, const int moves)
+    {
+        puzzle_node node;
+        puzzle_enumerator neighbors;
+        for (int i = 0; i != moves; ++i)
+        {
+            vector<puzzle_node> options;
+            for (neighbors(node); neighbors; ++neighbors)
+                options.push_back(*neighbors);
+
+            seed = seed * 1103515245 + 12345;
+            node = options[(seed >> 16) % options.size()];
+        }
+
+        return node;
+    }
+
+    /// Gets the optimal number of moves by breadth first search.
+    int solve_bfs(const puzzle_node& start)
+    {
+        unordered_map<puzzle_node, int, puzzle_hash> depths {{start, 0}};
+        deque<puzzle_node> queue {start};
+        puzzle_enumerator neighbors;
+        while (!queue.empty())
+        {
+            const puzzle_node node = queue.front();
+            queue.pop_front();
+            if (node == puzzle_node())
+                return depths[node];
+
+            for (neighbors(node); neighbors; ++neighbors)
+                if (depths.try_emplace(*neighbors, depths[node] + 1).second)
+                    queue.push_back(*neighbors);
+        }
+
+        return -1;
+    }
+
+    void test_zobrist()
+    {
+        [[maybe_unused]] puzzle_node node = scramble(5, 30);
+        assert(node.hash() == zobrist.hash(node.tiles()));
+        assert(zobrist(0, 1) != zobrist(1, 0) && zobrist(0, 1) != zobrist(0, 2));
+    }
+
+    void test_puzzles()
+    {
+        for (const unsigned seed: {1u, 2u, 3u})
+        {
+            const puzzle_node start = scramble(seed, 80);
+            const int expected = solve_bfs(start);
+            for (const size_t thread_count: {1, 2, 4})
+                for (const size_t batch_size: {1, 16})
+                {
+                    puzzle_algo as_algo(start, puzzle_node(), {}, puzzle_enumerator(), thread_count, batch_size);
+                    assert(as_algo.thread_count() == thread_count);
+                    [[maybe_unused]] const bool found = as_algo();
+                    assert(found && as_algo.cost() == expected);
+
+                    const auto path = as_algo.path();
+                    assert(static_cast<int>(path.size()) == expected + 1 && path.front() == start && path.back() == puzzle_node());
+                    for (size_t i = 1; i != path.size(); ++i)
+                    {
+                        bool adjacent = false;
+                        puzzle_enumerator neighbors;
+                        for (neighbors(path[i - 1]); neighbors; ++neighbors)
+                            adjacent = adjacent || *neighbors == path[i];
+
+                        assert(adjacent);
+                    }
+
+                    if (batch_size == 16)
+                        cout << "seed " << seed << ": moves=" << expected << " threads=" << thread_count
+                             << " expanded=" << as_algo.statistics().expanded_nodes << '\n';
+                }
+        }
+
+        // the instance can run again
+        puzzle_algo as_algo(scramble(9, 40), puzzle_node(), {}, puzzle_enumerator(), 3);
+        [[maybe_unused]] const bool found = as_algo();
+        [[maybe_unused]] const bool found_again = as_algo();
+        assert(found && found_again && as_algo.cost() == solve_bfs(scramble(9, 40)));
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_zobrist();
+    test_puzzles();
+
+    return 0;
+}
@@ -0,0 +1,154 @@
+#include "astar_jps.hpp"
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using node = grid_node<>;
+    using table = dense_node_table<int>;
+
+    /// Plain 8-connected enumerator without corner cutting, used as reference.
+    class octile_enumerator
+    {
+    public:
+        octile_enumerator(const grid_map& map): map_(map) {}
+
+        operator bool() const noexcept { return direction_ < 8; }
+
+        void operator()(const node& n)
+        {
+            x_ = n.x();
+            y_ = n.y();
+            direction_ = -1;
+            ++*this;
+        }
+
+        void operator++()
+        {
+            static constexpr int dx[] = {1, 1, 0, -1, -1, -1, 0, 1};
+            static constexpr int dy[] = {0, 1, 1, 1, 0, -1, -1, -1};
+            while (++direction_ < 8)
+            {
+                const int nx = x_ + dx[direction_], ny = y_ + dy[direction_];
+                if (map_.walkable(nx, ny) && map_.walkable(nx, y_) && map_.walkable(x_, ny))
+                {
+                    node_ = node(map_.index(nx, ny), nx, ny);
+                    break;
+                }
+            }
+        }
+
+        node& operator*() noexcept { return node_; }
+
+    private:
+        const grid_map& map_;
+        node node_;
+        int x_ {}, y_ {}, direction_ {8};
+    };
+
+    using octile_algo = astar::algo<node, dense_heap<node>, octile_enumerator, table, target_id_verifier, table>;
+
+    grid_map random_map(const int width, const int height, uint32_t seed)
+    {
+        grid_map map(width, height);
+        for (int y = 0; y != height; ++y)
+            for (int x = 0; x != width; ++x)
+            {
+                seed = seed * 1664525 + 1013904223;
+                map.set_walkable(x, y, (seed >> 24) % 100 >= 28);
+            }
+
+        return map;
+    }
+
+    template <typename _Algo>
+    int solve(_Algo& as_algo, const grid_map& map, const node& target, size_t& expanded)
+    {
+        while (as_algo())
+        {
+        }
+
+        expanded = as_algo.statistics().expanded_nodes;
+        if (!as_algo.has_solution())
+            return -1;
+
+        const auto path = expand_jump_path(map, as_algo.solution().path(target));
+        int cost = 0;
+        for (size_t i = 1; i < path.size(); ++i)
+        {
+            const int x0 = static_cast<int>(path[i - 1]) % map.width(), y0 = static_cast<int>(path[i - 1]) / map.width();
+            const int x1 = static_cast<int>(path[i]) % map.width(), y1 = static_cast<int>(path[i]) / map.width();
+            assert(abs(x1 - x0) <= 1 && abs(y1 - y0) <= 1 && map.walkable(x1, y1));
+            assert(map.walkable(x1, y0) && map.walkable(x0, y1));
+            cost += node::octile(abs(x1 - x0), abs(y1 - y0));
+        }
+
+        assert(cost == as_algo.node().general_score());
+        return cost;
+    }
+
+    void test_random_maps()
+    {
+        for (uint32_t seed = 1; seed != 30; ++seed)
+        {
+            const grid_map map = random_map(48, 40, seed);
+            const jump_table jumps(map);
+            uint32_t query = seed;
+            for (int i = 0; i != 10; ++i)
+            {
+                int coordinates[4];
+                for (auto& coordinate: coordinates)
+                {
+                    query = query * 1664525 + 1013904223;
+                    coordinate = static_cast<int>((query >> 16) % 40);
+                }
+
+                const auto [sx, sy, tx, ty] = coordinates;
+                if (!map.walkable(sx, sy) || !map.walkable(tx, ty))
+                    continue;
+
+                const node start(map.index(sx, sy), sx, sy), target(map.index(tx, ty), tx, ty);
+                size_t octile_expanded = 0, jps_expanded = 0, jps_plus_expanded = 0;
+                octile_algo reference(start, target, target, octile_enumerator(map), {});
+                jps_algo<> jps(start, target, target, jps_enumerator<>(map, target), {});
+                jps_algo<> jps_plus(start, target, target, jps_enumerator<>(map, target, &jumps), {});
+                const int cost = solve(reference, map, target, octile_expanded);
+                assert(solve(jps, map, target, jps_expanded) == cost);
+                assert(solve(jps_plus, map, target, jps_plus_expanded) == cost);
+                if (seed == 1)
+                    cout << "cost=" << cost << " expanded: octile=" << octile_expanded << " jps=" << jps_expanded << " jps+=" << jps_plus_expanded << '\n';
+            }
+        }
+    }
+
+    void test_jump_table()
+    {
+        const vector<string> rows = {
+            ".....",
+            "..#..",
+            ".....",
+        };
+        const grid_map map(rows);
+        const jump_table jumps(map);
+        // moving east on the top row, (3, 0) has a forced neighbor below behind the wall
+        assert(jumps.distance(map.index(0, 0), 0) == 3);
+        assert(jumps.distance(map.index(3, 0), 0) == -1);
+        assert(jumps.distance(map.index(2, 0), 2) == 0);
+        assert(jumps.distance(map.index(0, 1), 0) == -1);
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_jump_table();
+    test_random_maps();
+    return 0;
+}
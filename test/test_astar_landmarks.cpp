@@ -0,0 +1,140 @@
+#include "astar_landmarks.hpp"
+#include <cassert>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    /// Builds a road-like grid graph with random weights not shorter than the Euclidean distance.
+    template <typename _Weight>
+    csr_graph<_Weight> make_graph(const int width, const int height, const bool symmetric, uint32_t seed)
+    {
+        using graph = csr_graph<_Weight>;
+        vector<typename graph::edge> edges;
+        vector<csr_point> coordinates;
+        const auto weight = [&seed] {
+            seed = seed * 1664525 + 1013904223;
+            return static_cast<_Weight>(10 + (seed >> 24) % 40);
+        };
+
+        for (int y = 0; y != height; ++y)
+            for (int x = 0; x != width; ++x)
+            {
+                const auto id = static_cast<uint32_t>(y * width + x);
+                coordinates.push_back({static_cast<float>(x * 10), static_cast<float>(y * 10)});
+                for (const auto& [dx, dy]: {pair {1, 0}, pair {0, 1}})
+                    if (x + dx < width && y + dy < height)
+                    {
+                        const auto neighbor = static_cast<uint32_t>((y + dy) * width + x + dx);
+                        const auto forward = weight();
+                        edges.push_back({id, neighbor, forward});
+                        edges.push_back({neighbor, id, symmetric ? forward : weight()});
+                    }
+            }
+
+        graph result(static_cast<size_t>(width * height), edges);
+        result.set_coordinates(coordinates);
+        return result;
+    }
+
+    /// Checks that the heuristic never overestimates the distance to the target.
+    template <typename _Table, typename _Weight>
+    void check_admissible([[maybe_unused]] const _Table& landmarks, const csr_view<_Weight>& reverse, const uint32_t target)
+    {
+        vector<_Weight> distances;
+        detail::shortest_distances(reverse, target, distances);
+        for (uint32_t node = 0; node != distances.size(); ++node)
+            assert(landmarks.heuristic(node, target) <= distances[node]);
+    }
+
+    template <typename _Algo, typename _Node>
+    pair<typename _Node::score_type, size_t> solve(const _Node& start, const _Node& target, const csr_view<typename _Node::score_type>& graph)
+    {
+        _Algo as_algo(start, target, target, csr_enumerator<_Node>(graph, target), {});
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        return {as_algo.node().general_score(), as_algo.statistics().expanded_nodes};
+    }
+
+    void test_symmetric()
+    {
+        const auto owned = make_graph<int>(40, 30, true, 7);
+        const auto graph = owned.view();
+        for (const auto selection: {landmark_selection::farthest, landmark_selection::avoid})
+        {
+            const landmark_table<int> landmarks(graph, 8, selection);
+            assert(landmarks.landmark_count() == 8 && landmarks.exact() && !landmarks.directed());
+            check_admissible(landmarks, graph, 611);
+
+            for (const auto& [from, to]: {pair {0u, 1199u}, pair {39u, 1160u}, pair {615u, 17u}})
+            {
+                const auto euclidean = solve<csr_algo<int>>(csr_node<int>(graph, from), csr_node<int>(graph, to), graph);
+                const auto alt = solve<alt_algo<int>>(alt_node<int>(graph, landmarks, from), alt_node<int>(graph, landmarks, to), graph);
+                assert(euclidean.first == alt.first && alt.second <= euclidean.second);
+                cout << "cost=" << alt.first << " expanded: euclidean=" << euclidean.second << " alt=" << alt.second << '\n';
+            }
+        }
+    }
+
+    void test_directed()
+    {
+        const auto owned = make_graph<float>(30, 30, false, 11);
+        const auto reverse_owned = make_reverse_graph(owned.view());
+        const auto graph = owned.view(), reverse = reverse_owned.view();
+        const landmark_table<float> quantized(graph, reverse, 6);
+        const landmark_table<float, uint32_t, float> exact(graph, reverse, 6);
+        assert(quantized.directed() && !quantized.exact() && quantized.padded_count() == 8 && quantized.stride() == 16);
+        for (const uint32_t target: {0u, 455u, 899u})
+        {
+            check_admissible(quantized, reverse, target);
+            check_admissible(exact, reverse, target);
+        }
+
+        const auto euclidean = solve<csr_algo<float>>(csr_node<float>(graph, 31), csr_node<float>(graph, 868), graph);
+        const auto alt = solve<alt_algo<float, float>>(alt_node<float, uint32_t, float>(graph, exact, 31), alt_node<float, uint32_t, float>(graph, exact, 868), graph);
+        assert(euclidean.first == alt.first && alt.second <= euclidean.second);
+        cout << "cost=" << alt.first << " expanded: euclidean=" << euclidean.second << " alt=" << alt.second << '\n';
+    }
+
+    /// Compares the dispatched (vector) landmark bound with the scalar one.
+    template <typename _Distance>
+    void test_kernel()
+    {
+        constexpr size_t lanes = detail::landmark_lanes<_Distance>;
+        uint32_t seed = 3;
+        for (const size_t count: {lanes, 2 * lanes, 4 * lanes})
+        {
+            vector<_Distance> target(2 * count), node(2 * count);
+            for (size_t i = 0; i != 2 * count; ++i)
+            {
+                seed = seed * 1664525 + 1013904223;
+                target[i] = static_cast<_Distance>(seed >> 17);
+                node[i] = static_cast<_Distance>((seed * 7) >> 17);
+            }
+
+            assert(detail::landmark_bound(target.data(), node.data(), count, 0, count) ==
+                   detail::landmark_bound_scalar(target.data(), node.data(), count, 0, count));
+            assert(detail::landmark_bound(target.data(), node.data(), count, count, count) ==
+                   detail::landmark_bound_scalar(target.data(), node.data(), count, count, count));
+        }
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_kernel<uint16_t>();
+    test_kernel<float>();
+
+    test_symmetric();
+    test_directed();
+    return 0;
+}
@@ -0,0 +1,112 @@
+#include "astar_matrix.hpp"
+#include <cassert>
+#include <iostream>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using graph = csr_graph<int>;
+    using node = csr_node<int>;
+
+    /// Builds a 4-connected grid graph of pseudo-random edge weights in [1, 9], plus an isolated node.
+    graph make_graph(const int width, const int height)
+    {
+        vector<graph::edge> edges;
+        unsigned seed = 99;
+        for (int y = 0; y != height; ++y)
+            for (int x = 0; x != width; ++x)
+            {
+                const auto from = static_cast<uint32_t>(y * width + x);
+                const int dx[] = {1, 0, -1, 0}, dy[] = {0, 1, 0, -1};
+                for (int direction = 0; direction != 4; ++direction)
+                    if (x + dx[direction] >= 0 && x + dx[direction] < width && y + dy[direction] >= 0 && y + dy[direction] < height)
+                    {
+                        seed = seed * 1103515245 + 12345;
+                        const auto to = static_cast<uint32_t>((y + dy[direction]) * width + x + dx[direction]);
+                        edges.push_back({from, to, static_cast<int>(1 + (seed >> 16) % 9)});
+                    }
+            }
+
+        return graph(static_cast<size_t>(width * height) + 1, edges);
+    }
+
+    int solve(const csr_view<int>& view, const uint32_t start, const uint32_t target, size_t& expanded)
+    {
+        const node target_node(view, target);
+        csr_algo<int> as_algo(node(view, start), target_node, {target_node}, csr_enumerator<node>(view), {});
+        as_algo.run_steps(numeric_limits<size_t>::max());
+        expanded += as_algo.statistics().expanded_nodes;
+        return as_algo.has_solution() ? as_algo.node().general_score() : cost_matrix<int>::infinity;
+    }
+
+    void test_verifier()
+    {
+        const graph owned = make_graph(20, 20);
+        const auto view = owned.view();
+        const vector<node> targets = {node(view, 399), node(view, 21), node(view, 399), node(view, 0)};
+        csr_one_to_many_algo<int> as_algo(node(view, 0), node(view, 0), target_set_verifier<int>(targets), csr_enumerator<node>(view), {});
+        assert(as_algo.solution_verifier().target_count() == 4 && as_algo.solution_verifier().remaining() == 3);
+        [[maybe_unused]] bool can_continue = as_algo.run_steps(numeric_limits<size_t>::max());
+        assert(!can_continue && as_algo.has_solution());
+
+        [[maybe_unused]] size_t expanded = 0;
+        [[maybe_unused]] const auto& settled = as_algo.solution_verifier();
+        assert(settled.remaining() == 0 && settled.cost(3) == 0 && settled.cost(0) == settled.cost(2));
+        for (size_t i = 0; i != targets.size(); ++i)
+            assert(settled.cost(i) == solve(view, 0, targets[i].id(), expanded));
+
+        // the isolated node is never settled
+        as_algo.reset(node(view, 5), node(view, 5), target_set_verifier<int>(vector<node> {node(view, 21), node(view, 400)}));
+        can_continue = as_algo.run_steps(numeric_limits<size_t>::max());
+        assert(!can_continue && !as_algo.has_solution());
+        assert(as_algo.solution_verifier().remaining() == 1 && as_algo.solution_verifier().cost(1) == target_set_verifier<int>::infinity);
+        assert(as_algo.solution_verifier().cost(0) == solve(view, 5, 21, expanded));
+    }
+
+    void test_matrix()
+    {
+        const graph owned = make_graph(30, 30);
+        const auto reverse = make_reverse_graph(owned.view());
+        const auto view = owned.view();
+        const auto reverse_view = reverse.view();
+        const vector<uint32_t> sources = {0, 17, 450, 899, 311, 900, 640, 75, 288};
+        const vector<uint32_t> targets = {899, 3, 517, 900, 17};
+
+        size_t pairwise_expanded = 0;
+        cost_matrix<int> expected(sources.size(), targets.size());
+        for (size_t i = 0; i != sources.size(); ++i)
+            for (size_t j = 0; j != targets.size(); ++j)
+                expected(i, j) = sources[i] == targets[j] ? 0 : solve(view, sources[i], targets[j], pairwise_expanded);
+
+        work_stealing_pool pool(3);
+        const auto forward = many_to_many<int, uint32_t>(view, nullptr, sources, targets);
+        const auto backward = many_to_many<int, uint32_t>(view, &reverse_view, sources, targets);
+        const auto parallel = many_to_many<int, uint32_t>(view, &reverse_view, sources, targets, &pool);
+        const auto transposed = many_to_many<int, uint32_t>(view, &reverse_view, targets, sources, &pool);
+        assert(forward.rows() == sources.size() && forward.columns() == targets.size());
+        for (size_t i = 0; i != sources.size(); ++i)
+            for (size_t j = 0; j != targets.size(); ++j)
+            {
+                assert(forward(i, j) == expected(i, j) && backward(i, j) == expected(i, j) && parallel(i, j) == expected(i, j));
+                [[maybe_unused]] const int reverse_cost = targets[j] == sources[i] ? 0 : solve(view, targets[j], sources[i], pairwise_expanded);
+                assert(transposed(j, i) == reverse_cost);
+            }
+
+        assert(expected(5, 0) == cost_matrix<int>::infinity && expected(5, 3) == 0 && expected(0, 3) == cost_matrix<int>::infinity);
+        assert((many_to_many<int, uint32_t>(view, nullptr, {}, targets).values().empty()));
+        cout << "matrix " << sources.size() << "x" << targets.size() << ": " << pairwise_expanded << " expansions by pairwise searches\n";
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_verifier();
+    test_matrix();
+
+    return 0;
+}
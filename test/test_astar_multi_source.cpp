@@ -0,0 +1,203 @@
+#include "astar_node_table.hpp"
+#include "test_grid.hpp"
+#include <algorithm>
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using table = dense_node_table<int>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, target_ids_verifier, table>;
+    using set_algo = astar::algo<cell_node, quaternary_heap<cell_node>, enumerator, set<int>, target_ids_verifier, map<int, int>>;
+
+    /// Minimum aggregate counting its calls.
+    struct counting_min
+    {
+        static inline size_t calls = 0;
+
+        int operator()(const int aggregate, const int score) const noexcept
+        {
+            ++calls;
+            return min(aggregate, score);
+        }
+    };
+
+    using counting_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, target_ids_verifier, table, no_beam_search, counting_min>;
+
+    /// Gets the cost of the path between two cells with a single-source, single-target search.
+    int solve(grid& g, const pair<int, int> from, const pair<int, int> to, size_t& expanded)
+    {
+        cell_node start = g.at(from.first, from.second);
+        cell_node& target = g.at(to.first, to.second);
+        start.set_general_score(0);
+        dense_algo as_algo(start, target, target_ids_verifier(vector<cell_node> {target}), enumerator(g), {});
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        expanded += as_algo.statistics().expanded_nodes;
+        return as_algo.node().general_score();
+    }
+
+    vector<cell_node> make_nodes(grid& g, const vector<pair<int, int>>& cells, const vector<int>& costs = {})
+    {
+        vector<cell_node> nodes;
+        for (size_t i = 0; i != cells.size(); ++i)
+        {
+            nodes.push_back(g.at(cells[i].first, cells[i].second));
+            nodes.back().set_general_score(costs.empty() ? 0 : costs[i]);
+        }
+
+        return nodes;
+    }
+
+    /// Finds the nearest facility of a cell with one search from the facilities and one search to the facilities,
+    /// and compares them with a search per facility.
+    template <typename _Algo>
+    void test_nearest_facility()
+    {
+        grid g(weighted_maze);
+        const vector<pair<int, int>> facilities = {{9, 0}, {0, 9}, {5, 4}, {9, 8}};
+        const vector<int> opening_costs = {4, 0, 7, 2};
+        const pair<int, int> cell = {4, 6};
+
+        size_t single_expanded = 0;
+        int from_facilities = numeric_limits<int>::max(), to_facilities = numeric_limits<int>::max();
+        for (size_t i = 0; i != facilities.size(); ++i)
+        {
+            from_facilities = min(from_facilities, opening_costs[i] + solve(g, facilities[i], cell, single_expanded));
+            to_facilities = min(to_facilities, solve(g, cell, facilities[i], single_expanded));
+        }
+
+        // many sources, each one with its own initial cost, to one target
+        const auto starts = make_nodes(g, facilities, opening_costs);
+        const auto target = make_nodes(g, {cell});
+        _Algo backward(starts, target, target_ids_verifier(target), enumerator(g), {});
+        while (backward())
+        {
+        }
+
+        assert(backward.has_solution() && backward.node().general_score() == from_facilities);
+
+        // one source to many targets, under the minimum of the heuristic scores towards them
+        const auto targets = make_nodes(g, facilities);
+        _Algo forward(make_nodes(g, {cell}), targets, target_ids_verifier(targets), enumerator(g), {});
+        while (forward())
+        {
+        }
+
+        assert(forward.has_solution() && forward.node().general_score() == to_facilities);
+        [[maybe_unused]] const auto found = find_if(facilities.begin(), facilities.end(), [&](const auto& facility) {
+            return g.at(facility.first, facility.second).id() == forward.node().id();
+        });
+        assert(found != facilities.end());
+
+        if constexpr (_Algo::dense_mode)
+        {
+            const auto path = backward.solution().path(backward.node());
+            assert(path.back() == static_cast<size_t>(g.at(cell.first, cell.second).id()));
+            assert(any_of(starts.begin(), starts.end(), [&](const cell_node& start) { return static_cast<size_t>(start.id()) == path.front(); }));
+        }
+
+        const auto multi_expanded = backward.statistics().expanded_nodes + forward.statistics().expanded_nodes;
+        assert(multi_expanded < single_expanded);
+        cout << "nearest facility: " << multi_expanded << " expansions by two searches, " << single_expanded << " by a search per facility\n";
+    }
+
+    /// Reuses an instance for multi-source searches and for single-source searches.
+    void test_reset()
+    {
+        grid g(weighted_maze);
+        [[maybe_unused]] size_t expanded = 0;
+        const auto target = make_nodes(g, {{9, 8}});
+        dense_algo as_algo(make_nodes(g, {{0, 0}, {9, 0}}, {3, 0}), target, target_ids_verifier(target), enumerator(g), {});
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        assert(as_algo.node().general_score() == min(3 + solve(g, {0, 0}, {9, 8}, expanded), solve(g, {9, 0}, {9, 8}, expanded)));
+
+        as_algo.reset(make_nodes(g, {{0, 9}, {0, 0}}, {1, 50}), make_nodes(g, {{9, 8}, {5, 4}}));
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        assert(as_algo.node().general_score() == 1 + min(solve(g, {0, 9}, {9, 8}, expanded), solve(g, {0, 9}, {5, 4}, expanded)));
+
+        cell_node start = g.at(4, 6);
+        start.set_general_score(0);
+        as_algo.reset(start, g.at(0, 0));
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution() && as_algo.node().general_score() == solve(g, {4, 6}, {0, 0}, expanded));
+    }
+
+    /// Gives a start node more than once, with the lowest initial cost neither first nor last, and reaches a start
+    /// node by a path cheaper than its initial cost.
+    template <typename _Algo>
+    void test_duplicate_starts()
+    {
+        grid g(weighted_maze);
+        [[maybe_unused]] size_t expanded = 0;
+        const auto targets = make_nodes(g, {{9, 8}, {5, 4}});
+        _Algo as_algo(make_nodes(g, {{0, 9}, {0, 9}, {0, 0}, {0, 9}}, {20, 1, 50, 10}), targets, target_ids_verifier(targets), enumerator(g), {});
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        assert(as_algo.node().general_score() == 1 + min(solve(g, {0, 9}, {9, 8}, expanded), solve(g, {0, 9}, {5, 4}, expanded)));
+
+        // the optimal path goes through a start having a higher initial cost
+        grid row({"......"});
+        const auto target = make_nodes(row, {{5, 0}});
+        _Algo through(make_nodes(row, {{0, 0}, {1, 0}}, {0, 10}), target, target_ids_verifier(target), enumerator(row), {});
+        while (through())
+        {
+        }
+
+        assert(through.has_solution() && through.node().general_score() == 5);
+    }
+
+    /// Runs a multi-target search with a user-supplied aggregate.
+    void test_aggregate()
+    {
+        grid g(weighted_maze);
+        const auto targets = make_nodes(g, {{9, 0}, {0, 9}, {9, 8}});
+        counting_min::calls = 0;
+        counting_algo as_algo(make_nodes(g, {{4, 6}}), targets, target_ids_verifier(targets), enumerator(g), {});
+        while (as_algo())
+        {
+        }
+
+        [[maybe_unused]] size_t expanded = 0;
+        assert(as_algo.has_solution() && counting_min::calls != 0);
+        assert(as_algo.node().general_score() == min({solve(g, {4, 6}, {9, 0}, expanded), solve(g, {4, 6}, {0, 9}, expanded), solve(g, {4, 6}, {9, 8}, expanded)}));
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_nearest_facility<dense_algo>();
+    test_nearest_facility<set_algo>();
+    test_reset();
+    test_duplicate_starts<dense_algo>();
+    test_duplicate_starts<set_algo>();
+    test_aggregate();
+
+    return 0;
+}
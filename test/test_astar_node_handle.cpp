@@ -0,0 +1,66 @@
+#include "astar_node_handle.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <iostream>
+#include <type_traits>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using handle = node_handle<cell_node>;
+    using table = dense_node_table<int>;
+    using node_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+    using node_handle_algo = handle_algo<cell_node, enumerator, solution_verifier>;
+
+    static_assert(is_trivially_copyable_v<handle>);
+    static_assert(sizeof(handle) == sizeof(void*) + 2 * sizeof(int));
+
+    /// Checks that the heuristic scores inflated by epsilon and read from the heuristic cache reach the nodes.
+    void test_mirrored_scores()
+    {
+        grid g(weighted_maze);
+        cell_node& start = g.at(0, 0);
+        cell_node& target = g.at(9, 8);
+        node_handle_algo as_algo(start, target, {target.id()}, enumerator(g), {});
+        as_algo.solution().set_heuristic_cache(heuristic_cache::per_target);
+        as_algo.set_epsilon(2);
+        for (int query = 0; query != 2; ++query)
+        {
+            as_algo.reset(start, target);
+            as_algo.run_steps(5);
+            [[maybe_unused]] const handle& current = as_algo.node();
+            assert(current.heuristic_score() != 0 && current->heuristic_score() == current.heuristic_score());
+            assert(current->general_score() == current.general_score());
+        }
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    grid node_grid(weighted_maze);
+    node_algo by_node(node_grid.at(0, 0), node_grid.at(4, 4), {44}, enumerator(node_grid), {});
+    while (by_node())
+    {
+    }
+
+    grid handle_grid(weighted_maze);
+    node_handle_algo by_handle(handle_grid.at(0, 0), handle_grid.at(4, 4), {44}, enumerator(handle_grid), {});
+    while (by_handle())
+    {
+    }
+
+    assert(by_node.has_solution() && by_handle.has_solution());
+    assert(by_node.node().general_score() == by_handle.node().general_score());
+    assert(by_node.solution().path(by_node.node()) == by_handle.solution().path(by_handle.node()));
+    assert(&by_handle.node().get() == &handle_grid.at(4, 4));
+
+    cout << "cost=" << by_handle.node().general_score() << " expanded=" << by_handle.statistics().expanded_nodes
+         << " handle size=" << sizeof(handle) << " node size=" << sizeof(cell_node) << '\n';
+
+    test_mirrored_scores();
+    return 0;
+}
@@ -0,0 +1,174 @@
+#include "astar_node_table.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <set>
+#include <stop_token>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    using table = dense_node_table<int>;
+    using set_algo = astar::algo<cell_node, quaternary_heap<cell_node>, enumerator, set<int>, solution_verifier, map<int, int>>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+    using lazy_dense_algo = astar::algo<cell_node, default_priority_queue<cell_node>, enumerator, table, solution_verifier, table>;
+
+    template <typename _Algo>
+    int solve(const vector<const char*>& rows, search_statistics& statistics, vector<int>& path)
+    {
+        grid g(rows);
+        cell_node& start = g.at(0, 0);
+        cell_node& target = g.at(4, 4);
+        _Algo as_algo(start, target, {target.id()}, enumerator(g), {});
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        statistics = as_algo.statistics();
+        if constexpr (_Algo::dense_mode)
+        {
+            path.clear();
+            for (const auto index: as_algo.solution().path(target))
+                path.push_back(static_cast<int>(index));
+        }
+
+        return as_algo.node().general_score();
+    }
+
+    /// Runs several queries with the same dense algo instance and compares them with fresh instances.
+    void test_reset()
+    {
+        grid g(weighted_maze);
+        const pair<int, int> queries[][2] = {{{0, 0}, {4, 4}}, {{9, 0}, {0, 9}}, {{4, 4}, {9, 8}}, {{0, 0}, {4, 4}}};
+        dense_algo reused(g.at(0, 0), g.at(0, 0), {0}, enumerator(g), {});
+        for (const auto& query: queries)
+        {
+            cell_node& start = g.at(query[0].first, query[0].second);
+            cell_node& target = g.at(query[1].first, query[1].second);
+            reused.reset(start, target);
+            while (reused())
+            {
+            }
+
+            // the reference runs on a new grid, so it cannot share the scores left in the cells by the other queries
+            grid fresh_grid(weighted_maze);
+            dense_algo fresh(fresh_grid.at(query[0].first, query[0].second), fresh_grid.at(query[1].first, query[1].second), {target.id()}, enumerator(fresh_grid), {});
+            while (fresh())
+            {
+            }
+
+            assert(reused.has_solution() && fresh.has_solution());
+            assert(reused.node().general_score() == fresh.node().general_score());
+            assert(reused.solution().path(target) == fresh.solution().path(target));
+            assert(reused.statistics().expanded_nodes == fresh.statistics().expanded_nodes);
+        }
+    }
+
+    /// Runs queries to the same target with the heuristic cache modes and counts the heuristic evaluations.
+    void test_heuristic_cache()
+    {
+        grid g(weighted_maze);
+        cell_node& target = g.at(9, 8);
+        const pair<int, int> starts[] = {{0, 0}, {9, 0}, {0, 9}, {4, 4}};
+        size_t evaluations[3] = {};
+        [[maybe_unused]] int costs[3][4] = {};
+        for (const auto mode: {heuristic_cache::disabled, heuristic_cache::per_query, heuristic_cache::per_target})
+        {
+            const auto mode_index = static_cast<size_t>(mode);
+            dense_algo as_algo(g.at(0, 0), target, {target.id()}, enumerator(g), {});
+            as_algo.solution().set_heuristic_cache(mode);
+            cell_node::heuristic_evaluations = 0;
+            for (size_t i = 0; i != size(starts); ++i)
+            {
+                cell_node& start = g.at(starts[i].first, starts[i].second);
+                start.set_general_score(0);
+                as_algo.reset(start, target);
+                while (as_algo())
+                {
+                }
+
+                assert(as_algo.has_solution());
+                costs[mode_index][i] = as_algo.node().general_score();
+            }
+
+            evaluations[mode_index] = cell_node::heuristic_evaluations;
+        }
+
+        for (size_t i = 0; i != size(starts); ++i)
+            assert(costs[0][i] == costs[1][i] && costs[0][i] == costs[2][i]);
+
+        assert(evaluations[2] <= g.size() && evaluations[2] < evaluations[1] && evaluations[1] < evaluations[0]);
+        cout << "heuristic evaluations: disabled=" << evaluations[0] << " per query=" << evaluations[1] << " per target=" << evaluations[2] << '\n';
+    }
+
+    /// Runs the same query with the run methods and with the step-wise loop.
+    void test_run()
+    {
+        grid g(weighted_maze);
+        cell_node& start = g.at(0, 0);
+        cell_node& target = g.at(9, 8);
+        start.set_general_score(0);
+        dense_algo stepped(start, target, {target.id()}, enumerator(g), {});
+        while (stepped())
+        {
+        }
+
+        dense_algo as_algo(start, target, {target.id()}, enumerator(g), {});
+        [[maybe_unused]] bool can_continue = as_algo.run_steps(5);
+        assert(can_continue && as_algo.statistics().expanded_nodes == 5);
+        can_continue = as_algo.run_steps(0);
+        assert(can_continue && as_algo.statistics().expanded_nodes == 5);
+
+        stop_source stop;
+        stop.request_stop();
+        can_continue = as_algo.run_until(stop.get_token());
+        assert(can_continue && as_algo.statistics().expanded_nodes == 5);
+        can_continue = as_algo.run_for(chrono::nanoseconds::zero());
+        assert(can_continue && as_algo.statistics().expanded_nodes == 5);
+        can_continue = as_algo.run_until(stop_source().get_token(), 3);
+        assert(!can_continue);
+        assert(as_algo.has_solution() && as_algo.node().general_score() == stepped.node().general_score());
+        assert(as_algo.statistics().expanded_nodes == stepped.statistics().expanded_nodes);
+
+        as_algo.reset(start, target);
+        can_continue = as_algo.run_for(chrono::seconds(10));
+        assert(!can_continue && as_algo.has_solution());
+        assert(as_algo.node().general_score() == stepped.node().general_score());
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_reset();
+    test_heuristic_cache();
+    test_run();
+
+    for (const auto* rows: {&maze, &weighted_maze})
+    {
+        astar::search_statistics set_statistics, dense_statistics, lazy_statistics;
+        vector<int> dense_path, lazy_path;
+        [[maybe_unused]] const int set_cost = solve<set_algo>(*rows, set_statistics, dense_path);
+        const int dense_cost = solve<dense_algo>(*rows, dense_statistics, dense_path);
+        [[maybe_unused]] const int lazy_cost = solve<lazy_dense_algo>(*rows, lazy_statistics, lazy_path);
+        assert(set_cost == dense_cost && set_cost == lazy_cost);
+        assert(dense_path.front() == 0 && dense_path.back() == 44);
+        assert(dense_statistics.dropped_entries() == 0);
+
+        cout << "cost=" << dense_cost << " expanded: set=" << set_statistics.expanded_nodes << " dense=" << dense_statistics.expanded_nodes
+             << " lazy=" << lazy_statistics.expanded_nodes << " dropped=" << lazy_statistics.dropped_entries() << " path:";
+        for (const int id: dense_path)
+            cout << ' ' << id;
+
+        cout << '\n';
+    }
+
+    return 0;
+}
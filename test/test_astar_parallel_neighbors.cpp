@@ -0,0 +1,145 @@
+#include "astar_node_table.hpp"
+#include "astar_thread_pool.hpp"
+#include "test_grid.hpp"
+#include <atomic>
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    /// Grid enumerator generating the 4 candidate moves independently, each one after a costly check.
+    class checked_enumerator
+    {
+    public:
+        checked_enumerator(grid& g): grid_(&g) {}
+
+        size_t candidate_count(const cell_node&) const noexcept { return 4; }
+
+        optional<int> generate(const cell_node& node, const size_t index, cell_node& neighbor) const
+        {
+            static constexpr int dx[] = {1, 0, -1, 0};
+            static constexpr int dy[] = {0, 1, 0, -1};
+            ++checks;
+            // stands for a collision check
+            volatile unsigned work = 0;
+            for (unsigned i = 0; i != 2000; ++i)
+                work = work + i;
+
+            const int x = node.x() + dx[index], y = node.y() + dy[index];
+            if (!grid_->walkable(x, y))
+                return nullopt;
+
+            neighbor = grid_->at(x, y);
+            return node.distance_to(neighbor);
+        }
+
+        static inline atomic<size_t> checks = 0;
+
+    private:
+        grid* grid_;
+    };
+
+    /// Grid enumerator providing both protocols: the dense mode generates the candidates in parallel, while the set
+    /// mode, which cannot, enumerates the neighbors serially.
+    class dual_enumerator: public enumerator, public checked_enumerator
+    {
+    public:
+        dual_enumerator(grid& g): enumerator(g), checked_enumerator(g) {}
+    };
+
+    using table = dense_node_table<int>;
+    using dense_algo = astar::algo<cell_node, dense_heap<cell_node>, enumerator, table, solution_verifier, table>;
+    using parallel_algo = astar::algo<cell_node, dense_heap<cell_node>, checked_enumerator, table, solution_verifier, table>;
+    using dual_algo = astar::algo<cell_node, dense_heap<cell_node>, dual_enumerator, table, solution_verifier, table>;
+    using dual_set_algo = astar::algo<cell_node, quaternary_heap<cell_node>, dual_enumerator, set<int>, solution_verifier, map<int, int>>;
+    static_assert(parallel_algo::parallel_mode && dual_algo::parallel_mode && !dual_set_algo::parallel_mode && !dense_algo::parallel_mode);
+
+    template <typename _Algo>
+    _Algo solve(grid& g, cell_node& start, cell_node& target, executor* const parallel_executor)
+    {
+        start.set_general_score(0);
+        _Algo as_algo(start, target, {target.id()}, typename _Algo::neighbor_enumerator_type(g), {});
+        as_algo.set_executor(parallel_executor);
+        while (as_algo())
+        {
+        }
+
+        assert(as_algo.has_solution());
+        return as_algo;
+    }
+
+    void test_parallel_neighbors()
+    {
+        grid g(weighted_maze);
+        cell_node& start = g.at(0, 0);
+        cell_node& target = g.at(9, 8);
+        const auto reference = solve<dense_algo>(g, start, target, nullptr);
+        const auto reference_path = reference.solution().path(target);
+
+        work_stealing_pool pool(4);
+        pool_executor parallel_executor(pool);
+        for (auto* const current: {static_cast<executor*>(nullptr), static_cast<executor*>(&parallel_executor)})
+            for (int run = 0; run != 3; ++run)
+            {
+                checked_enumerator::checks = 0;
+                const auto as_algo = solve<parallel_algo>(g, start, target, current);
+                assert(as_algo.node().general_score() == reference.node().general_score());
+                assert(as_algo.statistics().expanded_nodes == reference.statistics().expanded_nodes);
+                assert(as_algo.solution().path(target) == reference_path);
+                assert(checked_enumerator::checks == 4 * reference.statistics().expanded_nodes);
+            }
+
+        // each run on a fresh grid, so the nodes carry no general score left by another run
+        grid dual_grid(weighted_maze);
+        const auto dual = solve<dual_algo>(dual_grid, dual_grid.at(0, 0), dual_grid.at(9, 8), &parallel_executor);
+        assert(dual.node().general_score() == reference.node().general_score());
+
+        grid set_grid(weighted_maze);
+        const auto set_algo = solve<dual_set_algo>(set_grid, set_grid.at(0, 0), set_grid.at(9, 8), &parallel_executor);
+        assert(set_algo.node().general_score() == reference.node().general_score());
+        cout << "cost=" << reference.node().general_score() << " expanded=" << reference.statistics().expanded_nodes << '\n';
+    }
+
+    void test_executor()
+    {
+        work_stealing_pool pool(3);
+        pool_executor parallel_executor(pool, 2);
+        vector<int> hits(101);
+        parallel_executor.parallel_for(hits.size(), [](void* context, const size_t index) { ++(*static_cast<vector<int>*>(context))[index]; }, &hits);
+        for ([[maybe_unused]] const int hit: hits)
+            assert(hit == 1);
+
+        [[maybe_unused]] bool thrown = false;
+        try
+        {
+            parallel_executor.parallel_for(10, [](void*, const size_t index) {
+                if (index == 3)
+                    throw runtime_error("failed");
+            }, nullptr);
+        }
+        catch (const runtime_error&)
+        {
+            thrown = true;
+        }
+
+        assert(thrown);
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_executor();
+    test_parallel_neighbors();
+
+    return 0;
+}
@@ -0,0 +1,126 @@
+#include "astar_priority_queue.hpp"
+#include "test_grid.hpp"
+#include <cassert>
+#include <iostream>
+#include <map>
+#include <queue>
+#include <set>
+#include <vector>
+
+using namespace std;
+using namespace stdext;
+
+namespace stdext::astar::test
+{
+    template <typename _PriorityQueue>
+    using grid_algo = astar::algo<cell_node, _PriorityQueue, enumerator, set<int>, solution_verifier, map<int, int>>;
+
+    template <typename _PriorityQueue>
+    int solve(unsigned& steps, search_statistics& statistics)
+    {
+        grid g(maze);
+        cell_node& start = g.at(0, 0);
+        cell_node& target = g.at(4, 4);
+        grid_algo<_PriorityQueue> as_algo(start, target, {target.id()}, enumerator(g), {});
+        steps = 0;
+        while (as_algo())
+            ++steps;
+
+        assert(as_algo.has_solution());
+        statistics = as_algo.statistics();
+        return as_algo.node().general_score();
+    }
+
+    void test_heap_order()
+    {
+        quaternary_heap<cell_node> heap;
+        for (int id = 0; id != 100; ++id)
+        {
+            cell_node node(id);
+            node.set_general_score((id * 37) % 101);
+            heap.push(node);
+        }
+
+        cell_node node(42);
+        node.set_general_score(-1);
+        assert(heap.contains(node));
+        heap.decrease_key(node);
+        assert(heap.size() == 100);
+        assert(heap.top().id() == 42);
+        heap.erase(cell_node(17));
+        heap.erase(cell_node(17));
+        assert(heap.size() == 99 && !heap.contains(cell_node(17)));
+
+        // a node which is not queued is pushed
+        cell_node removed(17);
+        removed.set_general_score(-2);
+        heap.decrease_key(removed);
+        assert(heap.size() == 100 && heap.top().id() == 17);
+
+        [[maybe_unused]] int last = -3;
+        while (!heap.empty())
+        {
+            assert(heap.top().total_score() >= last);
+            last = heap.top().total_score();
+            heap.pop();
+        }
+
+        assert(!heap.contains(node));
+    }
+
+    template <typename _PriorityQueue>
+    void test_monotone_order()
+    {
+        _PriorityQueue queue;
+        int score = -50;
+        for (int round = 0; round != 20; ++round)
+        {
+            for (int id = 0; id != 10; ++id)
+            {
+                cell_node node(id);
+                node.set_general_score(score + (id * 7919 + round * 31) % 3000);
+                queue.push(node);
+            }
+
+            for (int i = 0; i != 5; ++i)
+            {
+                assert(queue.top().total_score() >= score);
+                score = queue.top().total_score();
+                queue.pop();
+            }
+        }
+
+        while (!queue.empty())
+        {
+            assert(queue.top().total_score() >= score);
+            score = queue.top().total_score();
+            queue.pop();
+        }
+    }
+}
+
+int main()
+{
+    using namespace stdext::astar::test;
+
+    test_heap_order();
+    test_monotone_order<astar::radix_heap<cell_node>>();
+    test_monotone_order<astar::bucket_queue<cell_node, 16>>();
+    test_monotone_order<astar::default_priority_queue<cell_node>>();
+
+    unsigned binary_steps = 0, quaternary_steps = 0, octonary_steps = 0;
+    astar::search_statistics binary_statistics, quaternary_statistics, octonary_statistics;
+    [[maybe_unused]] const int binary_cost =
+        solve<priority_queue<cell_node, vector<cell_node>, greater<cell_node>>>(binary_steps, binary_statistics);
+    const int quaternary_cost = solve<astar::quaternary_heap<cell_node>>(quaternary_steps, quaternary_statistics);
+    [[maybe_unused]] const int octonary_cost = solve<astar::octonary_heap<cell_node>>(octonary_steps, octonary_statistics);
+    unsigned bucket_steps = 0;
+    astar::search_statistics bucket_statistics;
+    [[maybe_unused]] const int bucket_cost = solve<astar::default_priority_queue<cell_node>>(bucket_steps, bucket_statistics);
+    assert(binary_cost == quaternary_cost && binary_cost == octonary_cost && binary_cost == bucket_cost);
+    assert(quaternary_statistics.dropped_entries() == 0 && octonary_statistics.dropped_entries() == 0);
+
+    cout << "cost=" << quaternary_cost << " steps: binary=" << binary_steps << " quaternary=" << quaternary_steps
+         << " octonary=" << octonary_steps << " bucket=" << bucket_steps << " binary dropped=" << binary_statistics.dropped_entries() << '\n';
+    return 0;
+}
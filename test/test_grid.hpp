@@ -0,0 +1,130 @@
+/// Grid graph shared by the tests.
+#pragma once
+#include "astar_algo.hpp"
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace stdext::astar::test
+{
+    class cell_node: public base_node<int>
+    {
+    public:
+        cell_node(const int id = 0, const int x = 0, const int y = 0, const int cost = 1): id_(id), x_(x), y_(y), cost_(cost) {}
+
+        operator int() const noexcept { return id_; }
+
+        int id() const noexcept { return id_; }
+        int x() const noexcept { return x_; }
+        int y() const noexcept { return y_; }
+
+        /// Gets the cost of entering the given cell.
+        int distance_to(const cell_node& node) const noexcept { return node.cost_; }
+
+        void set_heuristic_score(int, const cell_node& target) noexcept
+        {
+            ++heuristic_evaluations;
+            base_node::set_heuristic_score(std::abs(x_ - target.x_) + std::abs(y_ - target.y_));
+        }
+
+        /// Number of heuristic evaluations of all nodes.
+        static inline std::size_t heuristic_evaluations = 0;
+
+    protected:
+        int id_, x_, y_, cost_;
+    };
+
+    /// 4-connected grid where '#' marks a wall and a digit the cost of entering the cell (1 by default).
+    class grid
+    {
+    public:
+        grid(const std::vector<const char*>& rows): width_(static_cast<int>(std::string(rows.front()).size())), rows_(rows)
+        {
+            for (int y = 0; y != static_cast<int>(rows.size()); ++y)
+                for (int x = 0; x != width_; ++x)
+                    nodes_.emplace_back(y * width_ + x, x, y, rows[y][x] >= '1' && rows[y][x] <= '9' ? rows[y][x] - '0' : 1);
+        }
+
+        bool walkable(const int x, const int y) const noexcept
+        {
+            return x >= 0 && y >= 0 && x < width_ && y < static_cast<int>(rows_.size()) && rows_[y][x] != '#';
+        }
+
+        cell_node& at(const int x, const int y) noexcept { return nodes_[y * width_ + x]; }
+
+        std::size_t size() const noexcept { return nodes_.size(); }
+
+    private:
+        int width_;
+        std::vector<const char*> rows_;
+        std::vector<cell_node> nodes_;
+    };
+
+    class enumerator
+    {
+    public:
+        enumerator(grid& g): grid_(g) {}
+
+        operator bool() const noexcept { return direction_ < 4; }
+
+        void operator()(const cell_node& node)
+        {
+            x_ = node.x();
+            y_ = node.y();
+            direction_ = -1;
+            ++*this;
+        }
+
+        void operator++()
+        {
+            static constexpr int dx[] = {1, 0, -1, 0};
+            static constexpr int dy[] = {0, 1, 0, -1};
+            while (++direction_ < 4 && !grid_.walkable(x_ + dx[direction_], y_ + dy[direction_]))
+            {
+            }
+
+            if (direction_ < 4)
+                node_ = &grid_.at(x_ + dx[direction_], y_ + dy[direction_]);
+        }
+
+        cell_node& operator*() noexcept { return *node_; }
+
+    private:
+        grid& grid_;
+        cell_node* node_ {};
+        int x_ {}, y_ {}, direction_ {4};
+    };
+
+    struct solution_verifier
+    {
+        int id;
+        bool operator()(const cell_node& node) const noexcept { return node.id() == id; }
+        void set_target(const cell_node& node) noexcept { id = node.id(); }
+    };
+
+    const std::vector<const char*> maze = {
+        "..........",
+        ".########.",
+        ".#......#.",
+        ".#.####.#.",
+        ".#.#..#.#.",
+        ".#.#.##.#.",
+        ".#.#....#.",
+        ".#.######.",
+        ".#........",
+        "...#######",
+    };
+
+    const std::vector<const char*> weighted_maze = {
+        "....9.....",
+        ".##.9.###.",
+        ".#..9...#.",
+        ".#.####.#.",
+        ".#.#..#.#.",
+        ".#.#.5#.#.",
+        ".#.#.3..#.",
+        ".#.####3#.",
+        ".#....2...",
+        "...#######",
+    };
+}